@@ -21,7 +21,8 @@ public class BDC_InteractionBackend : ModuleRules
 				"Core",
 				"Engine",
 				"GameplayTags",
-				"DeveloperSettings"
+				"DeveloperSettings",
+				"NetCore"
 			}
 		);
 			
@@ -8,6 +8,25 @@
  */
 #include "BDC_InteractionBackend.h"
 #include "Modules/ModuleManager.h"
+#include "BDC_InteractionStats.h"
+
+DEFINE_STAT(STAT_BDCInteraction_Update);
+DEFINE_STAT(STAT_BDCInteraction_RangeFilter);
+DEFINE_STAT(STAT_BDCInteraction_FoV);
+DEFINE_STAT(STAT_BDCInteraction_Traces);
+DEFINE_STAT(STAT_BDCInteraction_Sort);
+DEFINE_STAT(STAT_BDCInteraction_Diff);
+DEFINE_STAT(STAT_BDCInteraction_Broadcast);
+DEFINE_STAT(STAT_BDCInteraction_DebugDraw);
+
+DEFINE_STAT(STAT_BDCInteraction_ReceiversScanned);
+DEFINE_STAT(STAT_BDCInteraction_TracesIssued);
+DEFINE_STAT(STAT_BDCInteraction_CacheHits);
+DEFINE_STAT(STAT_BDCInteraction_TracesSaved);
+DEFINE_STAT(STAT_BDCInteraction_DelegatesFired);
+DEFINE_STAT(STAT_BDCInteraction_ScratchMemory);
+
+CSV_DEFINE_CATEGORY(BDCInteraction, true);
 
 #define LOCTEXT_NAMESPACE "FBDC_InteractionBackendModule"
 
@@ -0,0 +1,341 @@
+/* Copyright © beginning at 2026 - BlackDevilCreations
+ * Author: Patrick Wenzel
+ * All rights reserved.
+ * This file is part of a BlackDevilCreations project and may not be distributed, copied,
+ * or modified without prior written permission from BlackDevilCreations.
+ * Unreal Engine and its associated trademarks are property of Epic Games, Inc.
+ * and are used with permission.
+ */
+#include "CoreMinimal.h"
+
+#if !UE_BUILD_SHIPPING
+
+#include "BDC_InteractionBenchmark.h"
+#include "BDC_InteractionSubsystem.h"
+#include "BDC_InteractionSettings.h"
+#include "Components/InteractionInstigator.h"
+#include "Components/InteractionOccluder.h"
+#include "Components/InteractionReceiver.h"
+#include "Components/BoxComponent.h"
+#include "Components/SceneComponent.h"
+#include "Engine/CollisionProfile.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogBDCInteractionBenchmark, Log, All);
+
+struct FInteractionBenchmarkConfig
+{
+	int32 Receivers = 1000;
+	int32 Iterations = 200;
+	int32 Occluders = 0;
+	/** Distinct receiver names. Real levels reuse names, so by default every receiver shares one lookup bucket. */
+	int32 Names = 1;
+	float Extent = 5000.0f;
+	float PathRadius = 1000.0f;
+	FString OutputPath;
+};
+
+double FInteractionBenchmarkResult::GetTotalMicroseconds() const
+{
+	double TotalMicroseconds = 0.0;
+	for (const double Sample : SampleMicroseconds)
+	{
+		TotalMicroseconds += Sample;
+	}
+	return TotalMicroseconds;
+}
+
+double FInteractionBenchmarkResult::GetAverageMicroseconds() const
+{
+	return GetTotalMicroseconds() / FMath::Max(1, SampleMicroseconds.Num());
+}
+
+double FInteractionBenchmarkResult::GetMinMicroseconds() const
+{
+	return SampleMicroseconds.Num() > 0 ? FMath::Min(SampleMicroseconds) : 0.0;
+}
+
+double FInteractionBenchmarkResult::GetMaxMicroseconds() const
+{
+	return SampleMicroseconds.Num() > 0 ? FMath::Max(SampleMicroseconds) : 0.0;
+}
+
+FString FInteractionBenchmarkReport::ToCsv(TConstArrayView<FInteractionBenchmarkResult> Results)
+{
+	FString Csv = TEXT("Operation,Receivers,Samples,TotalMs,AvgUs,MinUs,MaxUs\n");
+	for (const FInteractionBenchmarkResult& Result : Results)
+	{
+		Csv += FString::Printf(TEXT("%s,%d,%d,%.4f,%.4f,%.4f,%.4f\n"),
+			*Result.Operation, Result.Receivers, Result.SampleMicroseconds.Num(), Result.GetTotalMicroseconds() / 1000.0,
+			Result.GetAverageMicroseconds(), Result.GetMinMicroseconds(), Result.GetMaxMicroseconds());
+	}
+	return Csv;
+}
+
+FString FInteractionBenchmarkReport::GetDefaultOutputPath(int32 Receivers)
+{
+	return FPaths::ProjectSavedDir() / TEXT("Benchmarks") / FString::Printf(TEXT("BDCInteraction_%d_%s.csv"), Receivers, *FDateTime::Now().ToString());
+}
+
+FString FInteractionBenchmarkReport::Save(TConstArrayView<FInteractionBenchmarkResult> Results, int32 Receivers, const FString& OutputPath)
+{
+	const FString Path = !OutputPath.IsEmpty() ? OutputPath : GetDefaultOutputPath(Receivers);
+	return FFileHelper::SaveStringToFile(ToCsv(Results), *Path) ? Path : FString();
+}
+
+class FInteractionBenchmarkRun
+{
+public:
+	FInteractionBenchmarkRun(UWorld* InWorld, UBDC_InteractionSubsystem* InSubsystem, const FInteractionBenchmarkConfig& InConfig)
+		: World(InWorld), Subsystem(InSubsystem), Config(InConfig), Random(0x8DC)
+	{
+	}
+
+	void Run()
+	{
+		SpawnOccluders();
+		SpawnReceivers();
+		SpawnInstigator();
+		if (!InstigatorComp)
+		{
+			Cleanup();
+			return;
+		}
+
+		for (int32 Iteration = 0; Iteration < Config.Iterations; ++Iteration)
+		{
+			const FTransform PathTransform = GetPathTransform(Iteration);
+			InstigatorActor->SetActorTransform(PathTransform);
+
+			Measure(TEXT("UpdateInteractions"), [&]() { Subsystem->UpdateInteractionsFor(InstigatorComp, PathTransform.GetLocation(), PathTransform.Rotator()); });
+			Measure(TEXT("CalcNextBest"), [&]() { Subsystem->CalcNextBestFor(InstigatorComp); });
+			Measure(TEXT("InjectInteraction"), [&]() { Subsystem->InjectInteractionFor(InstigatorComp); });
+		}
+
+		Measure(TEXT("UpdateAllInstigators"), [&]() { Subsystem->UpdateAllInstigators(); });
+
+		for (UInteractionReceiverComponent* ReceiverComp : ReceiverComps)
+		{
+			Measure(TEXT("RemoveReceiver"), [&]() { Subsystem->RemoveReceiver(ReceiverComp); });
+
+			FInteractionReceivers Entry;
+			Entry.InteractionActor = ReceiverComp->GetOwner();
+			Entry.InteractionComponent = ReceiverComp;
+			Measure(TEXT("AddReceiver"), [&]() { Subsystem->AddReceiver(Entry); });
+		}
+
+		for (AActor* ReceiverActor : ReceiverActors)
+		{
+			const FVector NewLocation = ReceiverActor->GetActorLocation() + FVector(Random.FRandRange(-50.0f, 50.0f), Random.FRandRange(-50.0f, 50.0f), 0.0f);
+			Measure(TEXT("MoveReceiver"), [&]() { ReceiverActor->SetActorLocation(NewLocation); });
+		}
+
+		FInteractionReceivers Found;
+		for (int32 Index = 0; Index < ReceiverComps.Num(); ++Index)
+		{
+			const FName ReceiverName = ReceiverComps[Index]->NameOfReceiver;
+			Measure(TEXT("GetReceiverByName"), [&]() { Subsystem->GetReceiverByName(ReceiverName, Found); });
+		}
+
+		Cleanup();
+		Report();
+	}
+
+private:
+	template <typename FunctionType>
+	void Measure(const TCHAR* Operation, FunctionType&& Function)
+	{
+		const double StartTime = FPlatformTime::Seconds();
+		Function();
+		const double ElapsedMicroseconds = (FPlatformTime::Seconds() - StartTime) * 1000000.0;
+
+		FInteractionBenchmarkResult* Result = Results.FindByPredicate([Operation](const FInteractionBenchmarkResult& Existing) { return Existing.Operation == Operation; });
+		if (!Result)
+		{
+			Result = &Results.AddDefaulted_GetRef();
+			Result->Operation = Operation;
+			Result->Receivers = Config.Receivers;
+		}
+		Result->SampleMicroseconds.Add(ElapsedMicroseconds);
+	}
+
+	AActor* SpawnBenchmarkActor(const FVector& Location)
+	{
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+		SpawnParams.ObjectFlags |= RF_Transient;
+
+		AActor* Actor = World->SpawnActor<AActor>(AActor::StaticClass(), FTransform(Location), SpawnParams);
+		if (!Actor) return nullptr;
+
+		USceneComponent* Root = NewObject<USceneComponent>(Actor, TEXT("Root"));
+		Root->SetMobility(EComponentMobility::Movable);
+		Actor->SetRootComponent(Root);
+		Root->SetWorldLocation(Location);
+		Root->RegisterComponent();
+
+		SpawnedActors.Add(Actor);
+		return Actor;
+	}
+
+	void SpawnOccluders()
+	{
+		for (int32 Index = 0; Index < Config.Occluders; ++Index)
+		{
+			AActor* Actor = SpawnBenchmarkActor(GetRandomLocation());
+			if (!Actor) continue;
+
+			const FVector Extent(Random.FRandRange(25.0f, 150.0f), Random.FRandRange(25.0f, 150.0f), 200.0f);
+
+			// The occluder feeds the coarse stage, the matching collision box the line traces behind it.
+			UInteractionOccluderComponent* Occluder = NewObject<UInteractionOccluderComponent>(Actor, TEXT("Occluder"));
+			Occluder->BoxExtent = Extent;
+			Occluder->SetupAttachment(Actor->GetRootComponent());
+			Occluder->RegisterComponent();
+
+			UBoxComponent* Box = NewObject<UBoxComponent>(Actor, TEXT("OccluderCollision"));
+			Box->SetBoxExtent(Extent);
+			Box->SetCollisionProfileName(UCollisionProfile::BlockAll_ProfileName);
+			Box->SetupAttachment(Occluder);
+			Box->RegisterComponent();
+		}
+	}
+
+	void SpawnReceivers()
+	{
+		ReceiverActors.Reserve(Config.Receivers);
+		ReceiverComps.Reserve(Config.Receivers);
+
+		for (int32 Index = 0; Index < Config.Receivers; ++Index)
+		{
+			AActor* Actor = SpawnBenchmarkActor(GetRandomLocation());
+			if (!Actor) continue;
+
+			UInteractionReceiverComponent* ReceiverComp = NewObject<UInteractionReceiverComponent>(Actor, TEXT("Receiver"));
+			ReceiverComp->NameOfReceiver = FName(TEXT("BenchmarkReceiver"), Index % Config.Names + 1);
+			ReceiverComp->RegisterComponent();
+
+			ReceiverActors.Add(Actor);
+			ReceiverComps.Add(ReceiverComp);
+		}
+	}
+
+	void SpawnInstigator()
+	{
+		InstigatorActor = SpawnBenchmarkActor(GetPathTransform(0).GetLocation());
+		if (!InstigatorActor) return;
+
+		InstigatorComp = NewObject<UInteractionInstigatorComponent>(InstigatorActor, TEXT("Instigator"));
+		InstigatorComp->NameOfInteractionComponent = TEXT("Root");
+		InstigatorComp->NameOfInstigator = TEXT("BenchmarkInstigator");
+		InstigatorComp->RegisterComponent();
+	}
+
+	void Cleanup()
+	{
+		for (AActor* Actor : SpawnedActors)
+		{
+			if (IsValid(Actor))
+			{
+				Actor->Destroy();
+			}
+		}
+		SpawnedActors.Reset();
+		ReceiverActors.Reset();
+		ReceiverComps.Reset();
+		InstigatorActor = nullptr;
+		InstigatorComp = nullptr;
+	}
+
+	FVector GetRandomLocation()
+	{
+		return FVector(Random.FRandRange(-Config.Extent, Config.Extent), Random.FRandRange(-Config.Extent, Config.Extent), 100.0f);
+	}
+
+	FTransform GetPathTransform(int32 Iteration) const
+	{
+		const float Angle = 2.0f * PI * Iteration / FMath::Max(1, Config.Iterations);
+		const FVector Location(FMath::Cos(Angle) * Config.PathRadius, FMath::Sin(Angle) * Config.PathRadius, 100.0f);
+		const FRotator Rotation(0.0f, FMath::RadiansToDegrees(Angle) + 90.0f, 0.0f);
+		return FTransform(Rotation, Location);
+	}
+
+	void Report() const
+	{
+		for (const FInteractionBenchmarkResult& Result : Results)
+		{
+			UE_LOG(LogBDCInteractionBenchmark, Display, TEXT("%-22s receivers=%d samples=%d avg=%.2fus min=%.2fus max=%.2fus"),
+				*Result.Operation, Result.Receivers, Result.SampleMicroseconds.Num(), Result.GetAverageMicroseconds(), Result.GetMinMicroseconds(), Result.GetMaxMicroseconds());
+		}
+
+		const FString OutputPath = FInteractionBenchmarkReport::Save(Results, Config.Receivers, Config.OutputPath);
+		if (!OutputPath.IsEmpty())
+		{
+			UE_LOG(LogBDCInteractionBenchmark, Display, TEXT("Wrote interaction benchmark results to %s"), *OutputPath);
+		}
+		else
+		{
+			UE_LOG(LogBDCInteractionBenchmark, Warning, TEXT("Could not write interaction benchmark results to %s"), Config.OutputPath.IsEmpty() ? *(FPaths::ProjectSavedDir() / TEXT("Benchmarks")) : *Config.OutputPath);
+		}
+	}
+
+	UWorld* World;
+	UBDC_InteractionSubsystem* Subsystem;
+	FInteractionBenchmarkConfig Config;
+	FRandomStream Random;
+
+	TArray<AActor*> SpawnedActors;
+	TArray<AActor*> ReceiverActors;
+	TArray<UInteractionReceiverComponent*> ReceiverComps;
+	AActor* InstigatorActor = nullptr;
+	UInteractionInstigatorComponent* InstigatorComp = nullptr;
+	TArray<FInteractionBenchmarkResult> Results;
+};
+
+static void RunInteractionBenchmark(const TArray<FString>& Args, UWorld* World)
+{
+	const UGameInstance* GI = World ? World->GetGameInstance() : nullptr;
+	UBDC_InteractionSubsystem* Subsystem = GI ? GI->GetSubsystem<UBDC_InteractionSubsystem>() : nullptr;
+	if (!Subsystem || !World->HasBegunPlay())
+	{
+		UE_LOG(LogBDCInteractionBenchmark, Warning, TEXT("BDC.Interaction.Benchmark needs a running game world."));
+		return;
+	}
+
+	const FString CommandLine = FString::Join(Args, TEXT(" "));
+	FInteractionBenchmarkConfig Config;
+	FParse::Value(*CommandLine, TEXT("Receivers="), Config.Receivers);
+	FParse::Value(*CommandLine, TEXT("Iterations="), Config.Iterations);
+	FParse::Value(*CommandLine, TEXT("Occluders="), Config.Occluders);
+	FParse::Value(*CommandLine, TEXT("Names="), Config.Names);
+	FParse::Value(*CommandLine, TEXT("Extent="), Config.Extent);
+	FParse::Value(*CommandLine, TEXT("PathRadius="), Config.PathRadius);
+	FParse::Value(*CommandLine, TEXT("Out="), Config.OutputPath);
+
+	Config.Receivers = FMath::Clamp(Config.Receivers, 1, 1000000);
+	Config.Iterations = FMath::Max(1, Config.Iterations);
+	Config.Occluders = FMath::Max(0, Config.Occluders);
+	Config.Names = FMath::Clamp(Config.Names, 1, Config.Receivers);
+
+	UE_LOG(LogBDCInteractionBenchmark, Display, TEXT("Running interaction benchmark: receivers=%d iterations=%d occluders=%d names=%d extent=%.0f"),
+		Config.Receivers, Config.Iterations, Config.Occluders, Config.Names, Config.Extent);
+
+	FInteractionBenchmarkRun BenchmarkRun(World, Subsystem, Config);
+	BenchmarkRun.Run();
+}
+
+static FAutoConsoleCommandWithWorldAndArgs InteractionBenchmarkCommand(
+	TEXT("BDC.Interaction.Benchmark"),
+	TEXT("Spawns synthetic receivers, occluders and an instigator path in the current world, times the interaction API and writes a CSV to Saved/Benchmarks. ")
+	TEXT("Args: Receivers=1000 Iterations=200 Occluders=0 Names=1 Extent=5000 PathRadius=1000 Out=<path>. Uses its own instigator and leaves the game's untouched."),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&RunInteractionBenchmark));
+
+#endif
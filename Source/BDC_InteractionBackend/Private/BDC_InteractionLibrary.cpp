@@ -11,242 +11,263 @@
 #include "Kismet/GameplayStatics.h"
 #include "Engine/GameInstance.h"
 #include "Engine/World.h"
+#include "UObject/ObjectKey.h"
 
-void UBDC_InteractionLibrary::SetInstigator(const UObject* WorldContextObject, UInteractionInstigatorComponent* NewInstigator)
+namespace BDC_InteractionLibraryCache
+{
+	/** Game thread only. The object key and weak pointer go stale on their own, so nothing has to listen for world cleanup. */
+	static TObjectKey<UWorld> LastWorld;
+	static TWeakObjectPtr<UBDC_InteractionSubsystem> LastSubsystem;
+}
+
+UBDC_InteractionSubsystem* UBDC_InteractionLibrary::GetInteractionSubsystem(const UObject* WorldContextObject)
 {
-	if (WorldContextObject)
+	using namespace BDC_InteractionLibraryCache;
+
+	if (!WorldContextObject) return nullptr;
+
+	const UWorld* World = WorldContextObject->GetWorld();
+	if (!World) return nullptr;
+
+	if (LastWorld == TObjectKey<UWorld>(World))
 	{
-		if (const UWorld* World = WorldContextObject->GetWorld())
+		if (UBDC_InteractionSubsystem* Subsystem = LastSubsystem.Get())
 		{
-			if (const UGameInstance* GI = World->GetGameInstance())
-			{
-				if (UBDC_InteractionSubsystem* Subsystem = GI->GetSubsystem<UBDC_InteractionSubsystem>())
-				{
-					Subsystem->SetInstigator(NewInstigator);
-				}
-			}
+			return Subsystem;
 		}
 	}
+
+	const UGameInstance* GI = World->GetGameInstance();
+	UBDC_InteractionSubsystem* Subsystem = GI ? GI->GetSubsystem<UBDC_InteractionSubsystem>() : nullptr;
+	LastWorld = World;
+	LastSubsystem = Subsystem;
+	return Subsystem;
+}
+
+void UBDC_InteractionLibrary::SetInstigator(const UObject* WorldContextObject, UInteractionInstigatorComponent* NewInstigator)
+{
+	if (UBDC_InteractionSubsystem* Subsystem = GetInteractionSubsystem(WorldContextObject))
+	{
+		Subsystem->SetInstigator(NewInstigator);
+	}
 }
 
 void UBDC_InteractionLibrary::GetLastInteraction(const UObject* WorldContextObject, FInteractionReceivers& LastReceiver)
 {
-	if (WorldContextObject)
+	if (const UBDC_InteractionSubsystem* Subsystem = GetInteractionSubsystem(WorldContextObject))
 	{
-		if (const UWorld* World = WorldContextObject->GetWorld())
-		{
-			if (const UGameInstance* GI = World->GetGameInstance())
-			{
-				if (const UBDC_InteractionSubsystem* Subsystem = GI->GetSubsystem<UBDC_InteractionSubsystem>())
-				{
-					Subsystem->GetLastInteraction(LastReceiver);
-				}
-			}
-		}
+		Subsystem->GetLastInteraction(LastReceiver);
 	}
 }
 
 void UBDC_InteractionLibrary::InjectInteraction(const UObject* WorldContextObject)
 {
-	if (WorldContextObject)
+	if (UBDC_InteractionSubsystem* Subsystem = GetInteractionSubsystem(WorldContextObject))
 	{
-		if (const UWorld* World = WorldContextObject->GetWorld())
-		{
-			if (const UGameInstance* GI = World->GetGameInstance())
-			{
-				if (UBDC_InteractionSubsystem* Subsystem = GI->GetSubsystem<UBDC_InteractionSubsystem>())
-				{
-					Subsystem->InjectInteraction();
-				}
-			}
-		}
+		Subsystem->InjectInteraction();
 	}
 }
 
 void UBDC_InteractionLibrary::UpdateInteractions(const UObject* WorldContextObject, FVector InstigatorLocation, FRotator InstigatorRotation)
 {
-	if (WorldContextObject)
+	if (UBDC_InteractionSubsystem* Subsystem = GetInteractionSubsystem(WorldContextObject))
 	{
-		if (const UWorld* World = WorldContextObject->GetWorld())
-		{
-			if (const UGameInstance* GI = World->GetGameInstance())
-			{
-				if (UBDC_InteractionSubsystem* Subsystem = GI->GetSubsystem<UBDC_InteractionSubsystem>())
-				{
-					Subsystem->UpdateInteractions(InstigatorLocation, InstigatorRotation);
-				}
-			}
-		}
+		Subsystem->UpdateInteractions(InstigatorLocation, InstigatorRotation);
 	}
 }
 
 void UBDC_InteractionLibrary::GetAllReceiversField(const UObject* WorldContextObject, TArray<UInteractionReceiverComponent*>& Receivers)
 {
-	if (WorldContextObject)
+	if (UBDC_InteractionSubsystem* Subsystem = GetInteractionSubsystem(WorldContextObject))
 	{
-		if (const UWorld* World = WorldContextObject->GetWorld())
-		{
-			if (const UGameInstance* GI = World->GetGameInstance())
-			{
-				if (UBDC_InteractionSubsystem* Subsystem = GI->GetSubsystem<UBDC_InteractionSubsystem>())
-				{
-					Subsystem->GetAllReceiversField(Receivers);
-				}
-			}
-		}
+		Subsystem->GetAllReceiversField(Receivers);
 	}
 }
 
 void UBDC_InteractionLibrary::GetAllReceiversOfLevel(const UObject* WorldContextObject, TArray<FInteractionReceivers>& Receivers)
 {
-	if (WorldContextObject)
+	if (const UBDC_InteractionSubsystem* Subsystem = GetInteractionSubsystem(WorldContextObject))
 	{
-		if (const UWorld* World = WorldContextObject->GetWorld())
-		{
-			if (const UGameInstance* GI = World->GetGameInstance())
-			{
-				if (const UBDC_InteractionSubsystem* Subsystem = GI->GetSubsystem<UBDC_InteractionSubsystem>())
-				{
-					Subsystem->GetAllReceiversOfLevel(Receivers);
-				}
-			}
-		}
+		Subsystem->GetAllReceiversOfLevel(Receivers);
 	}
 }
 
 void UBDC_InteractionLibrary::GetReceiverByTag(const UObject* WorldContextObject, FGameplayTag OfReceiverTag, FInteractionReceivers& Receiver)
 {
-	if (WorldContextObject)
+	if (const UBDC_InteractionSubsystem* Subsystem = GetInteractionSubsystem(WorldContextObject))
 	{
-		if (const UWorld* World = WorldContextObject->GetWorld())
-		{
-			if (const UGameInstance* GI = World->GetGameInstance())
-			{
-				if (const UBDC_InteractionSubsystem* Subsystem = GI->GetSubsystem<UBDC_InteractionSubsystem>())
-				{
-					Subsystem->GetReceiverByTag(OfReceiverTag, Receiver);
-				}
-			}
-		}
+		Subsystem->GetReceiverByTag(OfReceiverTag, Receiver);
 	}
 }
 
 void UBDC_InteractionLibrary::GetReceiverByName(const UObject* WorldContextObject, FName OfReceiverName, FInteractionReceivers& Receiver)
 {
-	if (WorldContextObject)
+	if (const UBDC_InteractionSubsystem* Subsystem = GetInteractionSubsystem(WorldContextObject))
 	{
-		if (const UWorld* World = WorldContextObject->GetWorld())
-		{
-			if (const UGameInstance* GI = World->GetGameInstance())
-			{
-				if (const UBDC_InteractionSubsystem* Subsystem = GI->GetSubsystem<UBDC_InteractionSubsystem>())
-				{
-					Subsystem->GetReceiverByName(OfReceiverName, Receiver);
-				}
-			}
-		}
+		Subsystem->GetReceiverByName(OfReceiverName, Receiver);
 	}
 }
 
 void UBDC_InteractionLibrary::GetInstigatorByTag(const UObject* WorldContextObject, FGameplayTag OfInstigatorTag, FInteractionReceivers& Instigator)
 {
-	if (WorldContextObject)
+	if (const UBDC_InteractionSubsystem* Subsystem = GetInteractionSubsystem(WorldContextObject))
 	{
-		if (const UWorld* World = WorldContextObject->GetWorld())
-		{
-			if (const UGameInstance* GI = World->GetGameInstance())
-			{
-				if (const UBDC_InteractionSubsystem* Subsystem = GI->GetSubsystem<UBDC_InteractionSubsystem>())
-				{
-					Subsystem->GetInstigatorByTag(OfInstigatorTag, Instigator);
-				}
-			}
-		}
+		Subsystem->GetInstigatorByTag(OfInstigatorTag, Instigator);
 	}
 }
 
 void UBDC_InteractionLibrary::GetInstigatorByName(const UObject* WorldContextObject, FName OfInstigatorName, FInteractionReceivers& Instigator)
 {
-	if (WorldContextObject)
+	if (const UBDC_InteractionSubsystem* Subsystem = GetInteractionSubsystem(WorldContextObject))
 	{
-		if (const UWorld* World = WorldContextObject->GetWorld())
-		{
-			if (const UGameInstance* GI = World->GetGameInstance())
-			{
-				if (const UBDC_InteractionSubsystem* Subsystem = GI->GetSubsystem<UBDC_InteractionSubsystem>())
-				{
-					Subsystem->GetInstigatorByName(OfInstigatorName, Instigator);
-				}
-			}
-		}
+		Subsystem->GetInstigatorByName(OfInstigatorName, Instigator);
 	}
 }
 
 void UBDC_InteractionLibrary::GetAllReceiversInView(const UObject* WorldContextObject, TArray<FInteractionReceivers>& OutReceiversInView)
 {
-	if (WorldContextObject)
+	if (const UBDC_InteractionSubsystem* Subsystem = GetInteractionSubsystem(WorldContextObject))
 	{
-		if (const UWorld* World = WorldContextObject->GetWorld())
-		{
-			if (const UGameInstance* GI = World->GetGameInstance())
-			{
-				if (const UBDC_InteractionSubsystem* Subsystem = GI->GetSubsystem<UBDC_InteractionSubsystem>())
-				{
-					Subsystem->GetAllReceiversInView(OutReceiversInView);
-				}
-			}
-		}
+		Subsystem->GetAllReceiversInView(OutReceiversInView);
 	}
 }
 
 void UBDC_InteractionLibrary::CalcNextBest(const UObject* WorldContextObject)
 {
-	if (WorldContextObject)
+	if (UBDC_InteractionSubsystem* Subsystem = GetInteractionSubsystem(WorldContextObject))
 	{
-		if (const UWorld* World = WorldContextObject->GetWorld())
-		{
-			if (const UGameInstance* GI = World->GetGameInstance())
-			{
-				if (UBDC_InteractionSubsystem* Subsystem = GI->GetSubsystem<UBDC_InteractionSubsystem>())
-				{
-					Subsystem->CalcNextBest();
-				}
-			}
-		}
+		Subsystem->CalcNextBest();
 	}
 }
 
 void UBDC_InteractionLibrary::CalcPrevBest(const UObject* WorldContextObject)
 {
-	if (WorldContextObject)
+	if (UBDC_InteractionSubsystem* Subsystem = GetInteractionSubsystem(WorldContextObject))
 	{
-		if (const UWorld* World = WorldContextObject->GetWorld())
-		{
-			if (const UGameInstance* GI = World->GetGameInstance())
-			{
-				if (UBDC_InteractionSubsystem* Subsystem = GI->GetSubsystem<UBDC_InteractionSubsystem>())
-				{
-					Subsystem->CalcPrevBest();
-				}
-			}
-		}
+		Subsystem->CalcPrevBest();
 	}
 }
 
 void UBDC_InteractionLibrary::GetCurrentBestFitting(const UObject* WorldContextObject, FInteractionReceivers& BestFit)
 {
-	if (WorldContextObject)
+	if (const UBDC_InteractionSubsystem* Subsystem = GetInteractionSubsystem(WorldContextObject))
 	{
-		if (const UWorld* World = WorldContextObject->GetWorld())
-		{
-			if (const UGameInstance* GI = World->GetGameInstance())
-			{
-				if (const UBDC_InteractionSubsystem* Subsystem = GI->GetSubsystem<UBDC_InteractionSubsystem>())
-				{
-					Subsystem->GetCurrentBestFitting(BestFit);
-				}
-			}
-		}
+		Subsystem->GetCurrentBestFitting(BestFit);
+	}
+}
+
+void UBDC_InteractionLibrary::UpdateAllInstigators(const UObject* WorldContextObject)
+{
+	if (UBDC_InteractionSubsystem* Subsystem = GetInteractionSubsystem(WorldContextObject))
+	{
+		Subsystem->UpdateAllInstigators();
+	}
+}
+
+void UBDC_InteractionLibrary::InjectInteractionFor(const UObject* WorldContextObject, UInteractionInstigatorComponent* ForInstigator)
+{
+	if (UBDC_InteractionSubsystem* Subsystem = GetInteractionSubsystem(WorldContextObject))
+	{
+		Subsystem->InjectInteractionFor(ForInstigator);
+	}
+}
+
+void UBDC_InteractionLibrary::GetAllReceiversFieldOf(const UObject* WorldContextObject, UInteractionInstigatorComponent* ForInstigator, TArray<UInteractionReceiverComponent*>& Receivers)
+{
+	if (const UBDC_InteractionSubsystem* Subsystem = GetInteractionSubsystem(WorldContextObject))
+	{
+		Subsystem->GetAllReceiversFieldOf(ForInstigator, Receivers);
+	}
+}
+
+void UBDC_InteractionLibrary::GetAllReceiversInViewOf(const UObject* WorldContextObject, UInteractionInstigatorComponent* ForInstigator, TArray<FInteractionReceivers>& OutReceiversInView)
+{
+	if (const UBDC_InteractionSubsystem* Subsystem = GetInteractionSubsystem(WorldContextObject))
+	{
+		Subsystem->GetAllReceiversInViewOf(ForInstigator, OutReceiversInView);
+	}
+}
+
+void UBDC_InteractionLibrary::GetCurrentBestFittingOf(const UObject* WorldContextObject, UInteractionInstigatorComponent* ForInstigator, FInteractionReceivers& BestFit)
+{
+	if (const UBDC_InteractionSubsystem* Subsystem = GetInteractionSubsystem(WorldContextObject))
+	{
+		Subsystem->GetCurrentBestFittingOf(ForInstigator, BestFit);
+	}
+}
+
+void UBDC_InteractionLibrary::CalcNextBestFor(const UObject* WorldContextObject, UInteractionInstigatorComponent* ForInstigator)
+{
+	if (UBDC_InteractionSubsystem* Subsystem = GetInteractionSubsystem(WorldContextObject))
+	{
+		Subsystem->CalcNextBestFor(ForInstigator);
+	}
+}
+
+void UBDC_InteractionLibrary::CalcPrevBestFor(const UObject* WorldContextObject, UInteractionInstigatorComponent* ForInstigator)
+{
+	if (UBDC_InteractionSubsystem* Subsystem = GetInteractionSubsystem(WorldContextObject))
+	{
+		Subsystem->CalcPrevBestFor(ForInstigator);
+	}
+}
+
+void UBDC_InteractionLibrary::GetReceiversByName(const UObject* WorldContextObject, FName OfReceiverName, TArray<FInteractionReceivers>& Receivers)
+{
+	if (const UBDC_InteractionSubsystem* Subsystem = GetInteractionSubsystem(WorldContextObject))
+	{
+		Subsystem->GetReceiversByName(OfReceiverName, Receivers);
+	}
+}
+
+void UBDC_InteractionLibrary::GetReceiversByTag(const UObject* WorldContextObject, FGameplayTag OfReceiverTag, bool bIncludeChildTags, TArray<FInteractionReceivers>& Receivers)
+{
+	if (const UBDC_InteractionSubsystem* Subsystem = GetInteractionSubsystem(WorldContextObject))
+	{
+		Subsystem->GetReceiversByTag(OfReceiverTag, bIncludeChildTags, Receivers);
+	}
+}
+
+void UBDC_InteractionLibrary::GetInstigatorsByTag(const UObject* WorldContextObject, FGameplayTag OfInstigatorTag, bool bIncludeChildTags, TArray<FInteractionReceivers>& Instigators)
+{
+	if (const UBDC_InteractionSubsystem* Subsystem = GetInteractionSubsystem(WorldContextObject))
+	{
+		Subsystem->GetInstigatorsByTag(OfInstigatorTag, bIncludeChildTags, Instigators);
+	}
+}
+
+void UBDC_InteractionLibrary::RegisterReceivers(const UObject* WorldContextObject, const TArray<UInteractionReceiverComponent*>& Receivers)
+{
+	if (UBDC_InteractionSubsystem* Subsystem = GetInteractionSubsystem(WorldContextObject))
+	{
+		Subsystem->RegisterReceivers(Receivers);
 	}
 }
 
+void UBDC_InteractionLibrary::UnregisterReceivers(const UObject* WorldContextObject, const TArray<UInteractionReceiverComponent*>& Receivers)
+{
+	if (UBDC_InteractionSubsystem* Subsystem = GetInteractionSubsystem(WorldContextObject))
+	{
+		Subsystem->UnregisterReceivers(Receivers);
+	}
+}
+
+void UBDC_InteractionLibrary::UpdateInteractionsAndGetState(const UObject* WorldContextObject, FVector InstigatorLocation, FRotator InstigatorRotation, FInteractionReceivers& BestFit, TArray<FInteractionReceivers>& ReceiversInView)
+{
+	if (UBDC_InteractionSubsystem* Subsystem = GetInteractionSubsystem(WorldContextObject))
+	{
+		Subsystem->UpdateInteractions(InstigatorLocation, InstigatorRotation);
+		Subsystem->GetCurrentBestFitting(BestFit);
+		Subsystem->GetAllReceiversInView(ReceiversInView);
+	}
+}
+
+void UBDC_InteractionLibrary::GetInteractionStateOf(const UObject* WorldContextObject, UInteractionInstigatorComponent* ForInstigator, FInteractionReceivers& BestFit, TArray<FInteractionReceivers>& ReceiversInView, TArray<UInteractionReceiverComponent*>& ReceiversInField)
+{
+	if (const UBDC_InteractionSubsystem* Subsystem = GetInteractionSubsystem(WorldContextObject))
+	{
+		Subsystem->GetCurrentBestFittingOf(ForInstigator, BestFit);
+		Subsystem->GetAllReceiversInViewOf(ForInstigator, ReceiversInView);
+		Subsystem->GetAllReceiversFieldOf(ForInstigator, ReceiversInField);
+	}
+}
\ No newline at end of file
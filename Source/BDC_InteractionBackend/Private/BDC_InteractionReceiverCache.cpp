@@ -0,0 +1,156 @@
+/* Copyright © beginning at 2026 - BlackDevilCreations
+ * Author: Patrick Wenzel
+ * All rights reserved.
+ * This file is part of a BlackDevilCreations project and may not be distributed, copied,
+ * or modified without prior written permission from BlackDevilCreations.
+ * Unreal Engine and its associated trademarks are property of Epic Games, Inc.
+ * and are used with permission.
+ */
+#include "BDC_InteractionReceiverCache.h"
+
+void FInteractionReceiverCache::Reset()
+{
+	Receivers.Reset();
+	PosX.Reset();
+	PosY.Reset();
+	PosZ.Reset();
+	Radius.Reset();
+	RangeOverride.Reset();
+	MaxVerticalDistance.Reset();
+	Priority.Reset();
+	ShapeBounds.Reset();
+	ShapeTransforms.Reset();
+	BoxExtents.Reset();
+	Flags.Reset();
+	RequiredTagMask.Reset();
+	Serials.Reset();
+	SlotOfReceiver.Reset();
+	FreeSlots.Reset();
+}
+
+int32 FInteractionReceiverCache::Add(UInteractionReceiverComponent* Receiver, const FVector& Location, float InRadius)
+{
+	if (!Receiver) return INDEX_NONE;
+
+	if (const int32* ExistingSlot = SlotOfReceiver.Find(Receiver))
+	{
+		Update(Receiver, Location, InRadius);
+		return *ExistingSlot;
+	}
+
+	int32 Slot;
+	if (FreeSlots.Num() > 0)
+	{
+		Slot = FreeSlots.Pop();
+	}
+	else
+	{
+		Slot = Receivers.AddZeroed();
+		PosX.AddZeroed();
+		PosY.AddZeroed();
+		PosZ.AddZeroed();
+		Radius.AddZeroed();
+		RangeOverride.AddZeroed();
+		MaxVerticalDistance.AddZeroed();
+		Priority.AddZeroed();
+		ShapeBounds.Add(FBox(ForceInit));
+		ShapeTransforms.Add(FTransform::Identity);
+		BoxExtents.Add(FVector::ZeroVector);
+		Flags.Add(EInteractionReceiverFlags::None);
+		RequiredTagMask.Add(0);
+		Serials.Add(0);
+	}
+
+	Receivers[Slot] = Receiver;
+	Flags[Slot] = EInteractionReceiverFlags::Active;
+	RequiredTagMask[Slot] = 0;
+	RangeOverride[Slot] = 0.0f;
+	MaxVerticalDistance[Slot] = 0.0f;
+	Priority[Slot] = 0.0f;
+	SlotOfReceiver.Add(Receiver, Slot);
+	Update(Receiver, Location, InRadius);
+	return Slot;
+}
+
+int32 FInteractionReceiverCache::Remove(UInteractionReceiverComponent* Receiver)
+{
+	int32 Slot;
+	if (!SlotOfReceiver.RemoveAndCopyValue(Receiver, Slot)) return INDEX_NONE;
+
+	Receivers[Slot] = nullptr;
+	Flags[Slot] = EInteractionReceiverFlags::None;
+	++Serials[Slot];
+	FreeSlots.Add(Slot);
+	return Slot;
+}
+
+void FInteractionReceiverCache::Reserve(int32 NumReceivers)
+{
+	Receivers.Reserve(NumReceivers);
+	PosX.Reserve(NumReceivers);
+	PosY.Reserve(NumReceivers);
+	PosZ.Reserve(NumReceivers);
+	Radius.Reserve(NumReceivers);
+	RangeOverride.Reserve(NumReceivers);
+	MaxVerticalDistance.Reserve(NumReceivers);
+	Priority.Reserve(NumReceivers);
+	ShapeBounds.Reserve(NumReceivers);
+	ShapeTransforms.Reserve(NumReceivers);
+	BoxExtents.Reserve(NumReceivers);
+	Flags.Reserve(NumReceivers);
+	RequiredTagMask.Reserve(NumReceivers);
+	Serials.Reserve(NumReceivers);
+	SlotOfReceiver.Reserve(NumReceivers);
+}
+
+void FInteractionReceiverCache::Update(UInteractionReceiverComponent* Receiver, const FVector& Location, float InRadius)
+{
+	const int32 Slot = FindSlot(Receiver);
+	if (Slot == INDEX_NONE) return;
+
+	PosX[Slot] = Location.X;
+	PosY[Slot] = Location.Y;
+	PosZ[Slot] = Location.Z;
+	Radius[Slot] = InRadius;
+}
+
+void FInteractionReceiverCache::SetTagFilter(int32 Slot, uint64 Mask, EInteractionReceiverFlags FilterFlags)
+{
+	if (!IsActiveSlot(Slot)) return;
+
+	RequiredTagMask[Slot] = Mask;
+	Flags[Slot] = (Flags[Slot] & ~EInteractionReceiverFlags::TagFilterMask) | (FilterFlags & EInteractionReceiverFlags::TagFilterMask);
+}
+
+void FInteractionReceiverCache::SetFlags(int32 Slot, EInteractionReceiverFlags InFlags, bool bSet)
+{
+	if (!IsActiveSlot(Slot)) return;
+
+	if (bSet)
+	{
+		Flags[Slot] |= InFlags;
+	}
+	else
+	{
+		Flags[Slot] &= ~InFlags;
+	}
+}
+
+void FInteractionReceiverCache::SetShape(int32 Slot, EInteractionReceiverFlags ShapeFlags, const FBox& Bounds, const FTransform& InShapeTransform, const FVector& InBoxExtent, float InRangeOverride, float InMaxVerticalDistance, float InPriority)
+{
+	if (!IsActiveSlot(Slot)) return;
+
+	Flags[Slot] = (Flags[Slot] & ~EInteractionReceiverFlags::NarrowPhaseMask) | (ShapeFlags & EInteractionReceiverFlags::NarrowPhaseMask);
+	ShapeBounds[Slot] = Bounds;
+	ShapeTransforms[Slot] = InShapeTransform;
+	BoxExtents[Slot] = InBoxExtent;
+	RangeOverride[Slot] = InRangeOverride;
+	MaxVerticalDistance[Slot] = InMaxVerticalDistance;
+	Priority[Slot] = InPriority;
+}
+
+int32 FInteractionReceiverCache::FindSlot(UInteractionReceiverComponent* Receiver) const
+{
+	const int32* Slot = SlotOfReceiver.Find(Receiver);
+	return Slot ? *Slot : INDEX_NONE;
+}
@@ -16,6 +16,30 @@ UBDC_InteractionSettings::UBDC_InteractionSettings()
 	
 	InteractionRange = 200.0f;
 	InteractionFoV = 60.0f;
+	MaxReceiversInView = 0;
+	bUseWeightedScoring = false;
+	DistanceWeight = 1.0f;
+	AngleWeight = 0.5f;
+	PriorityWeight = 1.0f;
+	RecentInteractionBonus = 0.25f;
+	RecentInteractionWindow = 5.0f;
+	BestFitHysteresis = 0.0f;
+	bAutoUpdateInteractions = false;
+	ActiveUpdateInterval = 0.0f;
+	IdleUpdateInterval = 0.25f;
+	AutoUpdateMovementThreshold = 1.0f;
+	AutoUpdateRotationThreshold = 0.5f;
+	SpatialGridCellSize = 500.0f;
+	bUseAsyncLineOfSight = false;
+	bCacheLineOfSight = false;
+	LineOfSightCacheQuantization = 25.0f;
+	LineOfSightCacheLifetime = 0.5f;
+	bUseCoarseOcclusion = false;
+	bBatchInteractionEvents = false;
+	bTimeSliceUpdates = false;
+	TimeSliceReceiverBudget = 256;
+	TimeSliceMicrosecondBudget = 0.0f;
+	MaxInteractionRequestsPerSecond = 10;
 }
 
 #if WITH_EDITOR
@@ -0,0 +1,95 @@
+/* Copyright © beginning at 2026 - BlackDevilCreations
+ * Author: Patrick Wenzel
+ * All rights reserved.
+ * This file is part of a BlackDevilCreations project and may not be distributed, copied,
+ * or modified without prior written permission from BlackDevilCreations.
+ * Unreal Engine and its associated trademarks are property of Epic Games, Inc.
+ * and are used with permission.
+ */
+#include "BDC_InteractionSpatialGrid.h"
+
+void FInteractionSpatialGrid::Reset(float InCellSize)
+{
+	CellSize = FMath::Max(1.0f, InCellSize);
+	Cells.Reset();
+	SlotCells.Reset();
+	SlotInGrid.Empty();
+	NumSlots = 0;
+}
+
+FIntPoint FInteractionSpatialGrid::GetCell(const FVector& Location) const
+{
+	return FIntPoint(FMath::FloorToInt(Location.X / CellSize), FMath::FloorToInt(Location.Y / CellSize));
+}
+
+void FInteractionSpatialGrid::Add(int32 Slot, const FVector& Location)
+{
+	if (Slot < 0) return;
+	if (Contains(Slot))
+	{
+		Move(Slot, Location);
+		return;
+	}
+
+	if (SlotCells.Num() <= Slot)
+	{
+		SlotCells.SetNumZeroed(Slot + 1);
+		SlotInGrid.Add(false, Slot + 1 - SlotInGrid.Num());
+	}
+
+	const FIntPoint Cell = GetCell(Location);
+	Cells.FindOrAdd(Cell).Add(Slot);
+	SlotCells[Slot] = Cell;
+	SlotInGrid[Slot] = true;
+	++NumSlots;
+}
+
+void FInteractionSpatialGrid::Remove(int32 Slot)
+{
+	if (!Contains(Slot)) return;
+
+	SlotInGrid[Slot] = false;
+	--NumSlots;
+
+	const FIntPoint Cell = SlotCells[Slot];
+	if (TArray<int32>* CellSlots = Cells.Find(Cell))
+	{
+		CellSlots->RemoveSingleSwap(Slot, false);
+		if (CellSlots->Num() == 0)
+		{
+			Cells.Remove(Cell);
+		}
+	}
+}
+
+void FInteractionSpatialGrid::Move(int32 Slot, const FVector& NewLocation)
+{
+	if (!Contains(Slot))
+	{
+		Add(Slot, NewLocation);
+		return;
+	}
+
+	if (SlotCells[Slot] != GetCell(NewLocation))
+	{
+		Remove(Slot);
+		Add(Slot, NewLocation);
+	}
+}
+
+void FInteractionSpatialGrid::Query(const FVector& Center, float Radius, TArray<int32>& OutSlots) const
+{
+	const FIntPoint MinCell = GetCell(Center - FVector(Radius, Radius, 0.0f));
+	const FIntPoint MaxCell = GetCell(Center + FVector(Radius, Radius, 0.0f));
+
+	for (int32 CellY = MinCell.Y; CellY <= MaxCell.Y; ++CellY)
+	{
+		for (int32 CellX = MinCell.X; CellX <= MaxCell.X; ++CellX)
+		{
+			if (const TArray<int32>* CellSlots = Cells.Find(FIntPoint(CellX, CellY)))
+			{
+				OutSlots.Append(*CellSlots);
+			}
+		}
+	}
+}
@@ -0,0 +1,50 @@
+/* Copyright © beginning at 2026 - BlackDevilCreations
+ * Author: Patrick Wenzel
+ * All rights reserved.
+ * This file is part of a BlackDevilCreations project and may not be distributed, copied,
+ * or modified without prior written permission from BlackDevilCreations.
+ * Unreal Engine and its associated trademarks are property of Epic Games, Inc.
+ * and are used with permission.
+ */
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+
+/**
+ * Stats of the interaction pipeline. Use "stat BDCInteraction" in builds with stats enabled,
+ * Unreal Insights (cpu channel) or "csvprofile start" in Test builds.
+ */
+DECLARE_STATS_GROUP(TEXT("BDC Interaction"), STATGROUP_BDCInteraction, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Update Interactions"), STAT_BDCInteraction_Update, STATGROUP_BDCInteraction, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Range Filter"), STAT_BDCInteraction_RangeFilter, STATGROUP_BDCInteraction, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("FoV"), STAT_BDCInteraction_FoV, STATGROUP_BDCInteraction, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Traces"), STAT_BDCInteraction_Traces, STATGROUP_BDCInteraction, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Sort"), STAT_BDCInteraction_Sort, STATGROUP_BDCInteraction, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Diff"), STAT_BDCInteraction_Diff, STATGROUP_BDCInteraction, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Delegate Broadcast"), STAT_BDCInteraction_Broadcast, STATGROUP_BDCInteraction, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Debug Draw"), STAT_BDCInteraction_DebugDraw, STATGROUP_BDCInteraction, );
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Receivers Scanned"), STAT_BDCInteraction_ReceiversScanned, STATGROUP_BDCInteraction, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Traces Issued"), STAT_BDCInteraction_TracesIssued, STATGROUP_BDCInteraction, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Trace Cache Hits"), STAT_BDCInteraction_CacheHits, STATGROUP_BDCInteraction, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Traces Saved By Occluders"), STAT_BDCInteraction_TracesSaved, STATGROUP_BDCInteraction, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Delegates Fired"), STAT_BDCInteraction_DelegatesFired, STATGROUP_BDCInteraction, );
+
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Scratch Buffers"), STAT_BDCInteraction_ScratchMemory, STATGROUP_BDCInteraction, );
+
+CSV_DECLARE_CATEGORY_EXTERN(BDCInteraction);
+
+/** Times a pipeline stage for the stat group, Unreal Insights and the CSV profiler at once. */
+#define BDC_INTERACTION_SCOPE(StageName) \
+	SCOPE_CYCLE_COUNTER(STAT_BDCInteraction_##StageName); \
+	TRACE_CPUPROFILER_EVENT_SCOPE(BDCInteraction_##StageName); \
+	CSV_SCOPED_TIMING_STAT(BDCInteraction, StageName)
+
+/** Adds to a pipeline counter for the stat group and the CSV profiler. */
+#define BDC_INTERACTION_COUNT(CounterName, Amount) \
+	INC_DWORD_STAT_BY(STAT_BDCInteraction_##CounterName, Amount); \
+	CSV_CUSTOM_STAT(BDCInteraction, CounterName, static_cast<int32>(Amount), ECsvCustomStatOp::Accumulate)
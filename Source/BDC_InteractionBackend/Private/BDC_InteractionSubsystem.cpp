@@ -10,14 +10,184 @@
 
 #include "DrawDebugHelpers.h"
 #include "BDC_InteractionSettings.h"
+#include "BDC_InteractionStats.h"
 #include "Components/InteractionInstigator.h"
+#include "Components/InteractionOccluder.h"
 #include "Components/InteractionReceiver.h"
 #include "Engine/World.h"
+#include "Engine/Level.h"
 #include "CollisionQueryParams.h"
+#include "Async/ParallelFor.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<int32> CVarInteractionParallelBatchSize(
+	TEXT("BDC.Interaction.ParallelBatchSize"),
+	256,
+	TEXT("Number of receivers evaluated per ParallelFor batch in the interaction range and FoV pass."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarInteractionParallelThreshold(
+	TEXT("BDC.Interaction.ParallelThreshold"),
+	1024,
+	TEXT("Candidate count from which the interaction range and FoV pass runs in parallel. Negative values disable the parallel path."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarInteractionTimeSlice(
+	TEXT("BDC.Interaction.TimeSlice"),
+	-1,
+	TEXT("Overrides bTimeSliceUpdates. -1 uses the interaction settings, 0 disables and 1 enables time-sliced updates."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarInteractionTimeSliceReceiverBudget(
+	TEXT("BDC.Interaction.TimeSliceReceiverBudget"),
+	-1,
+	TEXT("Overrides TimeSliceReceiverBudget. Negative values use the interaction settings, 0 removes the receiver limit."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarInteractionTimeSliceMicroseconds(
+	TEXT("BDC.Interaction.TimeSliceMicroseconds"),
+	-1.0f,
+	TEXT("Overrides TimeSliceMicrosecondBudget. Negative values use the interaction settings, 0 removes the time limit."),
+	ECVF_Default);
+
+void UBDC_InteractionSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	const UBDC_InteractionSettings* Settings = GetDefault<UBDC_InteractionSettings>();
+	ReceiverGrid.Reset(Settings ? Settings->SpatialGridCellSize : 500.0f);
+	ReachClassifiedRange = Settings ? Settings->InteractionRange : 0.0f;
+
+	LevelAddedHandle = FWorldDelegates::LevelAddedToWorld.AddUObject(this, &UBDC_InteractionSubsystem::OnLevelAddedToWorld);
+	LevelRemovedHandle = FWorldDelegates::LevelRemovedFromWorld.AddUObject(this, &UBDC_InteractionSubsystem::OnLevelRemovedFromWorld);
+	WorldCleanupHandle = FWorldDelegates::OnWorldCleanup.AddUObject(this, &UBDC_InteractionSubsystem::OnWorldCleanup);
+}
+
+void UBDC_InteractionSubsystem::Deinitialize()
+{
+	FWorldDelegates::LevelAddedToWorld.Remove(LevelAddedHandle);
+	FWorldDelegates::LevelRemovedFromWorld.Remove(LevelRemovedHandle);
+	FWorldDelegates::OnWorldCleanup.Remove(WorldCleanupHandle);
+
+	ReceiverGrid.Reset(ReceiverGrid.GetCellSize());
+	ReceiverCache.Reset();
+	LevelBuckets.Reset();
+	ReceiverLevelEntries.Reset();
+	DormantReceivers.Reset();
+	DormantIndices.Reset();
+	NextDormantWakeTime = TNumericLimits<double>::Max();
+	ReceiverLookup.Reset();
+	InstigatorLookup.Reset();
+	TagFilterBits.Reset();
+	++TagFilterSerial;
+	Occluders.Reset();
+	OccluderIndices.Reset();
+	++OccluderSerial;
+	InstigatorStates.Reset();
+	QueuedFieldChanges.Reset();
+	QueuedBestFitChanges.Reset();
+	FlushingFieldChanges.Reset();
+	FlushingBestFitChanges.Reset();
+	CandidateScratch.Empty();
+	GridQueryScratch.Empty();
+	AddedReceiversScratch.Empty();
+	RemovedReceiversScratch.Empty();
+	InstigatorScratch.Empty();
+	LargeReachSlots.Reset();
+
+	Super::Deinitialize();
+}
+
+void UBDC_InteractionSubsystem::Tick(float DeltaTime)
+{
+	const UBDC_InteractionSettings* Settings = GetDefault<UBDC_InteractionSettings>();
+	UWorld* World = GetWorld();
+	if (!Settings || !World) return;
+
+	if (World->GetTimeSeconds() >= NextDormantWakeTime)
+	{
+		WakeDueReceivers(World->GetTimeSeconds());
+	}
+
+	if (Settings->bAutoUpdateInteractions)
+	{
+		const double CurrentTime = World->GetTimeSeconds();
+		const double MovementThresholdSquared = FMath::Square(Settings->AutoUpdateMovementThreshold);
+		const double RotationThreshold = FMath::DegreesToRadians(Settings->AutoUpdateRotationThreshold);
+
+		TArray<UInteractionInstigatorComponent*> NestedInstigators;
+		TArray<UInteractionInstigatorComponent*>& Instigators = bIteratingInstigators ? NestedInstigators : InstigatorScratch;
+		TGuardValue<bool> IterationGuard(bIteratingInstigators, true);
+		Instigators.Reset();
+		Instigators.Append(InstigatorsOfLevel);
+
+		for (UInteractionInstigatorComponent* InstigatorComp : Instigators)
+		{
+			if (!InstigatorComp) continue;
+
+			const FTransform CurrentTransform = InstigatorComp->GetInstigatorTransform();
+			FInstigatorInteractionState& State = GetOrAddState(InstigatorComp);
+
+			const bool bSweepInProgress = State.SweepCursor < State.SweepCandidates.Num();
+			const bool bMoved = State.LastUpdateTime < 0.0
+				|| FVector::DistSquared(State.InstigatorTransform.GetLocation(), CurrentTransform.GetLocation()) > MovementThresholdSquared
+				|| State.InstigatorTransform.GetRotation().AngularDistance(CurrentTransform.GetRotation()) > RotationThreshold;
+
+			const float UpdateInterval = bMoved ? Settings->ActiveUpdateInterval : Settings->IdleUpdateInterval;
+			if (!bSweepInProgress && State.LastUpdateTime >= 0.0 && CurrentTime - State.LastUpdateTime < UpdateInterval) continue;
+
+			RunInstigatorUpdate(World, Settings, State, CurrentTransform.GetLocation(), CurrentTransform.Rotator(), CandidateScratch);
+		}
+
+		DrawDebugInstigators(World, Settings);
+	}
+
+	FlushInteractionEvents();
+	UpdateScratchMemoryStat();
+}
+
+ETickableTickType UBDC_InteractionSubsystem::GetTickableTickType() const
+{
+	return HasAnyFlags(RF_ClassDefaultObject) ? ETickableTickType::Never : ETickableTickType::Conditional;
+}
+
+bool UBDC_InteractionSubsystem::IsTickable() const
+{
+	const UBDC_InteractionSettings* Settings = GetDefault<UBDC_InteractionSettings>();
+	return Settings && GetWorld() && ((Settings->bAutoUpdateInteractions && InstigatorsOfLevel.Num() > 0) || HasQueuedInteractionEvents() || NextDormantWakeTime < TNumericLimits<double>::Max());
+}
+
+UWorld* UBDC_InteractionSubsystem::GetTickableGameObjectWorld() const
+{
+	return GetWorld();
+}
+
+TStatId UBDC_InteractionSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UBDC_InteractionSubsystem, STATGROUP_Tickables);
+}
+
+FInstigatorInteractionState& UBDC_InteractionSubsystem::GetOrAddState(UInteractionInstigatorComponent* ForInstigator)
+{
+	FInstigatorInteractionState& State = InstigatorStates.FindOrAdd(ForInstigator);
+	State.Instigator = ForInstigator;
+	return State;
+}
+
+const FInstigatorInteractionState* UBDC_InteractionSubsystem::FindState(UInteractionInstigatorComponent* ForInstigator) const
+{
+	return InstigatorStates.Find(ForInstigator);
+}
 
 void UBDC_InteractionSubsystem::GetLastInteraction(FInteractionReceivers& LastReceiver) const
 {
-	LastReceiver = LastInteractedWith;
+	GetLastInteractionOf(Instigator, LastReceiver);
+}
+
+void UBDC_InteractionSubsystem::GetLastInteractionOf(UInteractionInstigatorComponent* ForInstigator, FInteractionReceivers& LastReceiver) const
+{
+	const FInstigatorInteractionState* State = FindState(ForInstigator);
+	LastReceiver = State ? State->LastInteractedWith : FInteractionReceivers();
 }
 
 void UBDC_InteractionSubsystem::SetInstigator(UInteractionInstigatorComponent* NewInstigator)
@@ -25,301 +195,1901 @@ void UBDC_InteractionSubsystem::SetInstigator(UInteractionInstigatorComponent* N
 	Instigator = NewInstigator;
 }
 
-void UBDC_InteractionSubsystem::InjectInteraction()
-{
-	if (!Instigator) return;
+void UBDC_InteractionSubsystem::InjectInteraction()
+{
+	InjectInteractionFor(Instigator);
+}
+
+void UBDC_InteractionSubsystem::InjectInteractionFor(UInteractionInstigatorComponent* ForInstigator)
+{
+	if (!ForInstigator) return;
+
+	FInstigatorInteractionState* State = InstigatorStates.Find(ForInstigator);
+	if (!State) return;
+
+	if (UInteractionReceiverComponent* BestReceiver = Cast<UInteractionReceiverComponent>(State->CurrentBestFittingReceiver.InteractionComponent))
+	{
+		FireInteraction(*State, ForInstigator, BestReceiver);
+	}
+}
+
+static bool ShouldTimeSlice(const UBDC_InteractionSettings* Settings)
+{
+	const int32 TimeSliceOverride = CVarInteractionTimeSlice.GetValueOnGameThread();
+	return TimeSliceOverride > 0 || (TimeSliceOverride < 0 && Settings->bTimeSliceUpdates);
+}
+
+bool UBDC_InteractionSubsystem::InjectValidatedInteractionFor(UInteractionInstigatorComponent* ForInstigator, UInteractionReceiverComponent* ExpectedReceiver)
+{
+	const UBDC_InteractionSettings* Settings = GetDefault<UBDC_InteractionSettings>();
+	UWorld* World = GetWorld();
+	if (!ForInstigator || !Settings || !World) return false;
+
+	FInstigatorInteractionState& State = GetOrAddState(ForInstigator);
+
+	// The RPC is reliable and unthrottled, so a client could otherwise buy a full evaluation per call.
+	if (Settings->MaxInteractionRequestsPerSecond > 0)
+	{
+		const double RealTime = World->GetRealTimeSeconds();
+		if (State.RequestWindowStart < 0.0 || RealTime - State.RequestWindowStart >= 1.0)
+		{
+			State.RequestWindowStart = RealTime;
+			State.RequestsInWindow = 0;
+		}
+		if (State.RequestsInWindow >= Settings->MaxInteractionRequestsPerSecond) return false;
+		++State.RequestsInWindow;
+	}
+
+	// Never trust the client's view; evaluate from the server's copy of the instigator unless that already happened this frame.
+	// A time-sliced view may be mid-sweep or stitched together over several frames, so it is always re-evaluated in full.
+	// Async or cached line of sight may lag arbitrarily behind an on-demand check, so such a view is re-evaluated with blocking traces.
+	const double CurrentTime = World->GetTimeSeconds();
+	const bool bValidatedThisFrame = State.ValidationFrame == GFrameCounter && State.ValidationTime == CurrentTime;
+	const bool bViewMayBeStale = ShouldTimeSlice(Settings) || Settings->bUseAsyncLineOfSight || Settings->bCacheLineOfSight;
+	if (!bValidatedThisFrame && (bViewMayBeStale || State.LastUpdateTime < CurrentTime))
+	{
+		const FTransform CurrentTransform = ForInstigator->GetInstigatorTransform();
+		State.SweepCandidates.Reset();
+		State.SweepCursor = 0;
+
+		CandidateScratch.Reset();
+		GatherCandidates(Settings, CurrentTransform.GetLocation(), CandidateScratch);
+		UpdateInstigatorState(World, Settings, State, CurrentTransform.GetLocation(), CurrentTransform.Rotator(), CandidateScratch, true);
+		State.LastUpdateTime = CurrentTime;
+		State.ValidationFrame = GFrameCounter;
+		State.ValidationTime = CurrentTime;
+	}
+
+	// Anything in view is accepted so latency and hysteresis differences between client and server don't reject valid requests.
+	UInteractionReceiverComponent* Receiver = ExpectedReceiver ? ExpectedReceiver : Cast<UInteractionReceiverComponent>(State.CurrentBestFittingReceiver.InteractionComponent);
+	if (!Receiver || !State.ReceiversInView.Contains(Receiver)) return false;
+
+	FireInteraction(State, ForInstigator, Receiver);
+	return true;
+}
+
+void UBDC_InteractionSubsystem::FireInteraction(FInstigatorInteractionState& State, UInteractionInstigatorComponent* ForInstigator, UInteractionReceiverComponent* Receiver)
+{
+	State.LastInteractedWith.InteractionComponent = Receiver;
+	State.LastInteractedWith.InteractionActor = Receiver->GetOwner();
+	State.LastInteractionTime = GetWorld() ? GetWorld()->GetTimeSeconds() : -1.0;
+
+	BDC_INTERACTION_SCOPE(Broadcast);
+	Receiver->OnReceivedInteraction.Broadcast(ForInstigator->GetOwner(), ForInstigator->NameOfInstigator, ForInstigator->InstigatingTags);
+	OnInteractionFired.Broadcast(Receiver);
+	BDC_INTERACTION_COUNT(DelegatesFired, 2);
+}
+
+void UBDC_InteractionSubsystem::UpdateInteractions(FVector InstigatorLocation, FRotator InstigatorRotation)
+{
+	if (!Instigator && InstigatorsOfLevel.Num() > 0)
+	{
+		Instigator = InstigatorsOfLevel[0];
+	}
+
+	UpdateInteractionsFor(Instigator, InstigatorLocation, InstigatorRotation);
+}
+
+void UBDC_InteractionSubsystem::UpdateInteractionsFor(UInteractionInstigatorComponent* ForInstigator, FVector InstigatorLocation, FRotator InstigatorRotation)
+{
+	const UBDC_InteractionSettings* Settings = GetDefault<UBDC_InteractionSettings>();
+	UWorld* World = GetWorld();
+	if (!Settings || !World) return;
+
+	RunInstigatorUpdate(World, Settings, GetOrAddState(ForInstigator), InstigatorLocation, InstigatorRotation, CandidateScratch);
+	DrawDebugInstigators(World, Settings);
+	UpdateScratchMemoryStat();
+}
+
+void UBDC_InteractionSubsystem::UpdateAllInstigators()
+{
+	const UBDC_InteractionSettings* Settings = GetDefault<UBDC_InteractionSettings>();
+	UWorld* World = GetWorld();
+	if (!Settings || !World) return;
+
+	// Listeners may re-enter through a non-batched flush, so only the outermost loop owns the scratch copy.
+	TArray<UInteractionInstigatorComponent*> NestedInstigators;
+	TArray<UInteractionInstigatorComponent*>& Instigators = bIteratingInstigators ? NestedInstigators : InstigatorScratch;
+	TGuardValue<bool> IterationGuard(bIteratingInstigators, true);
+	Instigators.Reset();
+	Instigators.Append(InstigatorsOfLevel);
+
+	for (UInteractionInstigatorComponent* InstigatorComp : Instigators)
+	{
+		if (!InstigatorComp) continue;
+
+		const FTransform CurrentTransform = InstigatorComp->GetInstigatorTransform();
+		RunInstigatorUpdate(World, Settings, GetOrAddState(InstigatorComp), CurrentTransform.GetLocation(), CurrentTransform.Rotator(), CandidateScratch);
+	}
+
+	DrawDebugInstigators(World, Settings);
+	UpdateScratchMemoryStat();
+}
+
+void UBDC_InteractionSubsystem::RunInstigatorUpdate(UWorld* World, const UBDC_InteractionSettings* Settings, FInstigatorInteractionState& State, const FVector& InstigatorLocation, const FRotator& InstigatorRotation, TArray<FInteractionCandidate>& Candidates)
+{
+	BDC_INTERACTION_SCOPE(Update);
+
+	if (ShouldTimeSlice(Settings))
+	{
+		UpdateInstigatorStateSliced(World, Settings, State, InstigatorLocation, InstigatorRotation);
+	}
+	else
+	{
+		Candidates.Reset();
+		GatherCandidates(Settings, InstigatorLocation, Candidates);
+		UpdateInstigatorState(World, Settings, State, InstigatorLocation, InstigatorRotation, Candidates, false);
+	}
+
+	State.LastUpdateTime = World->GetTimeSeconds();
+	// This view may come from async traces or an unfinished sweep, so the next request validates again.
+	State.ValidationFrame = MAX_uint64;
+}
+
+void UBDC_InteractionSubsystem::GatherCandidates(const UBDC_InteractionSettings* Settings, const FVector& Center, TArray<FInteractionCandidate>& OutCandidates)
+{
+	BDC_INTERACTION_SCOPE(RangeFilter);
+
+	if (Settings->InteractionRange != ReachClassifiedRange)
+	{
+		ReclassifyReceiverReach(Settings->InteractionRange);
+	}
+
+	TArray<int32>& CandidateSlots = GridQueryScratch;
+	CandidateSlots.Reset();
+	ReceiverGrid.Query(Center, GetBroadPhaseRadius(Settings->InteractionRange), CandidateSlots);
+
+	OutCandidates.Reserve(OutCandidates.Num() + CandidateSlots.Num() + LargeReachSlots.Num());
+	for (const int32 Slot : CandidateSlots)
+	{
+		if (ReceiverCache.HasAnyFlags(Slot, EInteractionReceiverFlags::LargeReach)) continue;
+
+		FInteractionCandidate& Candidate = OutCandidates.AddDefaulted_GetRef();
+		Candidate.Receiver = ReceiverCache.Receivers[Slot];
+		Candidate.Slot = Slot;
+	}
+
+	// Dormant and streamed-out receivers stay on the list but out of the grid, so grid membership still decides.
+	for (const int32 Slot : LargeReachSlots)
+	{
+		if (!ReceiverGrid.Contains(Slot)) continue;
+
+		FInteractionCandidate& Candidate = OutCandidates.AddDefaulted_GetRef();
+		Candidate.Receiver = ReceiverCache.Receivers[Slot];
+		Candidate.Slot = Slot;
+	}
+}
+
+float UBDC_InteractionSubsystem::GetBroadPhaseRadius(float GlobalRange) const
+{
+	return GlobalRange + ReceiverGrid.GetCellSize() * 0.5f;
+}
+
+void UBDC_InteractionSubsystem::ClassifyReceiverReach(int32 Slot)
+{
+	const float Range = ReceiverCache.RangeOverride[Slot] > 0.0f ? ReceiverCache.RangeOverride[Slot] : ReachClassifiedRange;
+	const bool bLargeReach = Range + ReceiverCache.Radius[Slot] > GetBroadPhaseRadius(ReachClassifiedRange);
+	if (bLargeReach == ReceiverCache.HasAnyFlags(Slot, EInteractionReceiverFlags::LargeReach)) return;
+
+	ReceiverCache.SetFlags(Slot, EInteractionReceiverFlags::LargeReach, bLargeReach);
+	if (bLargeReach)
+	{
+		LargeReachSlots.Add(Slot);
+	}
+	else
+	{
+		LargeReachSlots.RemoveSingleSwap(Slot, false);
+	}
+}
+
+void UBDC_InteractionSubsystem::ReclassifyReceiverReach(float GlobalRange)
+{
+	ReachClassifiedRange = GlobalRange;
+	for (int32 Slot = 0; Slot < ReceiverCache.NumSlots(); ++Slot)
+	{
+		if (ReceiverCache.IsActiveSlot(Slot))
+		{
+			ClassifyReceiverReach(Slot);
+		}
+	}
+}
+
+void UBDC_InteractionSubsystem::UpdateInstigatorState(UWorld* World, const UBDC_InteractionSettings* Settings, FInstigatorInteractionState& State, const FVector& InstigatorLocation, const FRotator& InstigatorRotation, TArray<FInteractionCandidate>& Candidates, bool bBlockingLineOfSight)
+{
+	State.InstigatorTransform.SetLocation(InstigatorLocation);
+	State.InstigatorTransform.SetRotation(InstigatorRotation.Quaternion());
+
+	State.PendingReceiversInField.Reset();
+	State.PendingFieldSlots.Reset();
+	State.PendingViewEntries.Reset();
+	++State.SweepSerial;
+
+	ProcessCandidates(World, Settings, State, InstigatorLocation, InstigatorRotation, Candidates, bBlockingLineOfSight);
+	CommitInstigatorState(State);
+}
+
+void UBDC_InteractionSubsystem::UpdateInstigatorStateSliced(UWorld* World, const UBDC_InteractionSettings* Settings, FInstigatorInteractionState& State, const FVector& InstigatorLocation, const FRotator& InstigatorRotation)
+{
+	State.InstigatorTransform.SetLocation(InstigatorLocation);
+	State.InstigatorTransform.SetRotation(InstigatorRotation.Quaternion());
+
+	if (State.SweepCursor >= State.SweepCandidates.Num())
+	{
+		State.SweepCandidates.Reset();
+		State.SweepCursor = 0;
+		State.PendingReceiversInField.Reset();
+		State.PendingFieldSlots.Reset();
+		State.PendingViewEntries.Reset();
+		++State.SweepSerial;
+		GatherCandidates(Settings, InstigatorLocation, State.SweepCandidates);
+	}
+
+	const int32 ReceiverBudgetOverride = CVarInteractionTimeSliceReceiverBudget.GetValueOnGameThread();
+	const float MicrosecondBudgetOverride = CVarInteractionTimeSliceMicroseconds.GetValueOnGameThread();
+	const int32 ReceiverBudget = ReceiverBudgetOverride >= 0 ? ReceiverBudgetOverride : Settings->TimeSliceReceiverBudget;
+	const float MicrosecondBudget = MicrosecondBudgetOverride >= 0.0f ? MicrosecondBudgetOverride : Settings->TimeSliceMicrosecondBudget;
+
+	constexpr int32 ChunkSize = 64;
+	const double StartTime = FPlatformTime::Seconds();
+	int32 ReceiversLeft = ReceiverBudget > 0 ? ReceiverBudget : MAX_int32;
+
+	while (State.SweepCursor < State.SweepCandidates.Num() && ReceiversLeft > 0)
+	{
+		const int32 ChunkCount = FMath::Min3(ChunkSize, ReceiversLeft, State.SweepCandidates.Num() - State.SweepCursor);
+		TArrayView<FInteractionCandidate> Chunk(State.SweepCandidates.GetData() + State.SweepCursor, ChunkCount);
+
+		for (FInteractionCandidate& Candidate : Chunk)
+		{
+			if (!ReceiverCache.Receivers.IsValidIndex(Candidate.Slot) || ReceiverCache.Receivers[Candidate.Slot] != Candidate.Receiver
+				|| ReceiverCache.HasAnyFlags(Candidate.Slot, EInteractionReceiverFlags::OutOfGridMask))
+			{
+				Candidate.Receiver = nullptr;
+			}
+		}
+
+		ProcessCandidates(World, Settings, State, InstigatorLocation, InstigatorRotation, Chunk, false);
+
+		State.SweepCursor += ChunkCount;
+		ReceiversLeft -= ChunkCount;
+
+		if (MicrosecondBudget > 0.0f && (FPlatformTime::Seconds() - StartTime) * 1000000.0 >= MicrosecondBudget)
+		{
+			break;
+		}
+	}
+
+	if (State.SweepCursor >= State.SweepCandidates.Num())
+	{
+		CommitInstigatorState(State);
+	}
+}
+
+void UBDC_InteractionSubsystem::ProcessCandidates(UWorld* World, const UBDC_InteractionSettings* Settings, FInstigatorInteractionState& State, const FVector& InstigatorLocation, const FRotator& InstigatorRotation, TArrayView<FInteractionCandidate> Candidates, bool bBlockingLineOfSight)
+{
+	UInteractionInstigatorComponent* StateInstigator = State.Instigator;
+	AActor* InstigatorActor = StateInstigator ? StateInstigator->GetOwner() : nullptr;
+
+	FRotator AdjustedInstigatorRotation = InstigatorRotation;
+	if (StateInstigator)
+	{
+		AdjustedInstigatorRotation.Yaw += StateInstigator->InstigatorOffsetViewRotation;
+	}
+	EvaluateCandidates(Settings, InstigatorLocation, AdjustedInstigatorRotation.Vector(), Candidates);
+
+	const int32 MaxReceiversInView = Settings->MaxReceiversInView;
+	auto WorseFirst = [](const FInteractionViewEntry& A, const FInteractionViewEntry& B) { return A.Score < B.Score; };
+	TArray<FInteractionViewEntry>& ViewEntries = State.PendingViewEntries;
+
+	const bool bWeightedScoring = Settings->bUseWeightedScoring;
+	const UInteractionReceiverComponent* RecentReceiver = nullptr;
+	if (bWeightedScoring && State.LastInteractionTime >= 0.0 && World->GetTimeSeconds() - State.LastInteractionTime <= Settings->RecentInteractionWindow)
+	{
+		RecentReceiver = Cast<UInteractionReceiverComponent>(State.LastInteractedWith.InteractionComponent);
+	}
+
+	const uint64 InstigatorTagMask = GetInstigatorTagMask(State);
+	const TConstArrayView<const FInteractionOccluder*> NearbyOccluders = GetNearbyOccluders(Settings, State, InstigatorLocation);
+
+	for (const FInteractionCandidate& Candidate : Candidates)
+	{
+		if (!Candidate.bInRange || !Candidate.Receiver) continue;
+		if (StateInstigator && !PassesTagFilter(Candidate.Slot, InstigatorTagMask, StateInstigator)) continue;
+
+		UInteractionReceiverComponent* ReceiverComp = Candidate.Receiver;
+		if (HasLineOfSight(World, Settings, State, InstigatorLocation, ReceiverCache.GetHandle(Candidate.Slot), ReceiverComp, Candidate.Location, InstigatorActor, NearbyOccluders, bBlockingLineOfSight))
+		{
+			State.PendingReceiversInField.Add(ReceiverComp);
+			State.PendingFieldSlots.Add(Candidate.Slot);
+			if (Candidate.bInView)
+			{
+				const float Score = bWeightedScoring ? ScoreCandidate(Settings, Candidate, ReceiverComp == RecentReceiver) : -Candidate.EffectiveDistance;
+				if (MaxReceiversInView <= 0)
+				{
+					ViewEntries.Add({ Score, ReceiverComp });
+				}
+				else if (ViewEntries.Num() < MaxReceiversInView)
+				{
+					ViewEntries.HeapPush({ Score, ReceiverComp }, WorseFirst);
+				}
+				else if (Score > ViewEntries.HeapTop().Score)
+				{
+					ViewEntries.HeapPopDiscard(WorseFirst);
+					ViewEntries.HeapPush({ Score, ReceiverComp }, WorseFirst);
+				}
+			}
+		}
+	}
+}
+
+float UBDC_InteractionSubsystem::ScoreCandidate(const UBDC_InteractionSettings* Settings, const FInteractionCandidate& Candidate, bool bRecentlyInteracted) const
+{
+	FInteractionScoreInput Input;
+	Input.Receiver = Candidate.Receiver;
+	Input.EffectiveDistance = Candidate.EffectiveDistance;
+	Input.Range = Candidate.Range;
+	Input.ViewCosine = Candidate.ViewCosine;
+	Input.Priority = ReceiverCache.Priority[Candidate.Slot];
+	Input.bRecentlyInteracted = bRecentlyInteracted;
+
+	if (CustomScoring.IsBound())
+	{
+		return CustomScoring.Execute(Input);
+	}
+
+	const float NormalizedDistance = Input.Range > 0.0f ? Input.EffectiveDistance / Input.Range : Input.EffectiveDistance;
+	return Input.ViewCosine * Settings->AngleWeight
+		- NormalizedDistance * Settings->DistanceWeight
+		+ Input.Priority * Settings->PriorityWeight
+		+ (bRecentlyInteracted ? Settings->RecentInteractionBonus : 0.0f);
+}
+
+static void RebuildViewReceivers(FInstigatorInteractionState& State)
+{
+	State.ViewReceivers.Reset(State.ReceiversInView.Num());
+	for (UInteractionReceiverComponent* Comp : State.ReceiversInView)
+	{
+		if (Comp)
+		{
+			FInteractionReceivers& Data = State.ViewReceivers.AddDefaulted_GetRef();
+			Data.InteractionActor = Comp->GetOwner();
+			Data.InteractionComponent = Comp;
+		}
+	}
+}
+
+int32 UBDC_InteractionSubsystem::SelectBestReceiverIndex(TConstArrayView<FInteractionViewEntry> SortedEntries, const UInteractionReceiverComponent* OldBest) const
+{
+	// The previous best keeps its place unless the top entry beats it by more than the hysteresis margin.
+	const UBDC_InteractionSettings* Settings = GetDefault<UBDC_InteractionSettings>();
+	if (!OldBest || SortedEntries.Num() == 0 || !Settings) return 0;
+
+	for (int32 Index = 1; Index < SortedEntries.Num(); ++Index)
+	{
+		if (SortedEntries[Index].Receiver == OldBest)
+		{
+			return SortedEntries[0].Score - SortedEntries[Index].Score <= Settings->BestFitHysteresis ? Index : 0;
+		}
+	}
+	return 0;
+}
+
+void UBDC_InteractionSubsystem::CommitInstigatorState(FInstigatorInteractionState& State)
+{
+	UInteractionInstigatorComponent* StateInstigator = State.Instigator;
+
+	// The pending buffers are rebuilt on the next update, so they are sorted in place and swapped
+	// with the committed lists instead of copied. Capacity survives on both sides.
+	TArray<UInteractionReceiverComponent*>& NewReceiversInView = State.PendingReceiversInView;
+	{
+		BDC_INTERACTION_SCOPE(Sort);
+
+		State.PendingViewEntries.Sort([](const FInteractionViewEntry& A, const FInteractionViewEntry& B) {
+			return A.Score > B.Score;
+		});
+
+		NewReceiversInView.Reset();
+		for (const FInteractionViewEntry& Entry : State.PendingViewEntries)
+		{
+			NewReceiversInView.Add(Entry.Receiver);
+		}
+	}
+
+	const TArray<UInteractionReceiverComponent*>& NewReceiversInField = State.PendingReceiversInField;
+	const TArray<int32>& NewFieldSlots = State.PendingFieldSlots;
+	TArray<UInteractionReceiverComponent*>& AddedReceivers = AddedReceiversScratch;
+	TArray<UInteractionReceiverComponent*>& RemovedReceivers = RemovedReceiversScratch;
+	AddedReceivers.Reset();
+	RemovedReceivers.Reset();
+	UInteractionReceiverComponent* OldBestReceiver = Cast<UInteractionReceiverComponent>(State.CurrentBestFittingReceiver.InteractionComponent);
+	UInteractionReceiverComponent* NewBestReceiver = nullptr;
+	{
+		BDC_INTERACTION_SCOPE(Diff);
+
+		if (FieldGeneration >= MAX_uint32 - 2)
+		{
+			FMemory::Memzero(FieldStamps.GetData(), FieldStamps.Num() * sizeof(uint32));
+			FieldGeneration = 0;
+		}
+		if (FieldStamps.Num() < ReceiverCache.NumSlots())
+		{
+			FieldStamps.AddZeroed(ReceiverCache.NumSlots() - FieldStamps.Num());
+		}
+
+		// Old members get stamped OldGeneration, new ones overwrite it with NewGeneration.
+		// Whatever still carries OldGeneration afterwards has left the field.
+		const uint32 OldGeneration = ++FieldGeneration;
+		const uint32 NewGeneration = ++FieldGeneration;
+
+		for (const int32 Slot : State.FieldSlots)
+		{
+			if (FieldStamps.IsValidIndex(Slot))
+			{
+				FieldStamps[Slot] = OldGeneration;
+			}
+		}
+
+		for (int32 Index = 0; Index < NewReceiversInField.Num(); ++Index)
+		{
+			const int32 Slot = NewFieldSlots[Index];
+			if (!FieldStamps.IsValidIndex(Slot))
+			{
+				AddedReceivers.Add(NewReceiversInField[Index]);
+				continue;
+			}
+
+			if (FieldStamps[Slot] != OldGeneration)
+			{
+				AddedReceivers.Add(NewReceiversInField[Index]);
+			}
+			FieldStamps[Slot] = NewGeneration;
+		}
+
+		bool bViewChanged = (State.ReceiversInView.Num() != NewReceiversInView.Num());
+		if (!bViewChanged)
+		{
+			for (int32 Index = 0; Index < State.ReceiversInView.Num(); ++Index)
+			{
+				if (State.ReceiversInView[Index] != NewReceiversInView[Index])
+				{
+					bViewChanged = true;
+					break;
+				}
+			}
+		}
+
+		Swap(State.ReceiversInView, State.PendingReceiversInView);
+		if (bViewChanged)
+		{
+			RebuildViewReceivers(State);
+		}
+
+		if (State.ReceiversInView.Num() > 0)
+		{
+			// A cycled-to best stays while the view is unchanged, a best held by hysteresis has to keep earning its place.
+			if (bViewChanged || State.bBestHeldByHysteresis || !State.ReceiversInView.IsValidIndex(State.CurrentBestReceiverIndex))
+			{
+				State.CurrentBestReceiverIndex = SelectBestReceiverIndex(State.PendingViewEntries, OldBestReceiver);
+				State.bBestHeldByHysteresis = State.CurrentBestReceiverIndex > 0;
+			}
+			NewBestReceiver = State.ReceiversInView[State.CurrentBestReceiverIndex];
+		}
+		else
+		{
+			State.CurrentBestReceiverIndex = 0;
+			State.bBestHeldByHysteresis = false;
+		}
+
+		if (StateInstigator)
+		{
+			for (int32 Index = 0; Index < State.ReceiversInField.Num(); ++Index)
+			{
+				const int32 Slot = State.FieldSlots[Index];
+				if (!FieldStamps.IsValidIndex(Slot) || FieldStamps[Slot] == OldGeneration)
+				{
+					RemovedReceivers.Add(State.ReceiversInField[Index]);
+				}
+			}
+		}
+
+		Swap(State.ReceiversInField, State.PendingReceiversInField);
+		Swap(State.FieldSlots, State.PendingFieldSlots);
+	}
+
+	for (UInteractionReceiverComponent* ReceiverComp : AddedReceivers)
+	{
+		QueueFieldChange(StateInstigator, ReceiverComp, 1);
+	}
+
+	if (OldBestReceiver != NewBestReceiver)
+	{
+		QueueBestFitChange(StateInstigator, OldBestReceiver, NewBestReceiver);
+		State.CurrentBestFittingReceiver.InteractionComponent = NewBestReceiver;
+		State.CurrentBestFittingReceiver.InteractionActor = NewBestReceiver ? NewBestReceiver->GetOwner() : nullptr;
+	}
+
+	for (UInteractionReceiverComponent* Receiver : RemovedReceivers)
+	{
+		if (Receiver)
+		{
+			QueueFieldChange(StateInstigator, Receiver, -1);
+		}
+	}
+
+	if (StateInstigator && (AddedReceivers.Num() > 0 || RemovedReceivers.Num() > 0 || OldBestReceiver != NewBestReceiver))
+	{
+		StateInstigator->ReplicateInteractionState(AddedReceivers, RemovedReceivers, NewBestReceiver);
+	}
+
+	DispatchQueuedEventsUnlessBatched();
+}
+
+void UBDC_InteractionSubsystem::QueueFieldChange(UInteractionInstigatorComponent* ForInstigator, UInteractionReceiverComponent* ReceiverComp, int32 Delta)
+{
+	QueuedFieldChanges.FindOrAdd(TPair<UInteractionInstigatorComponent*, UInteractionReceiverComponent*>(ForInstigator, ReceiverComp)) += Delta;
+}
+
+void UBDC_InteractionSubsystem::QueueBestFitChange(UInteractionInstigatorComponent* ForInstigator, UInteractionReceiverComponent* OldBest, UInteractionReceiverComponent* NewBest)
+{
+	if (FInteractionQueuedBestFit* Existing = QueuedBestFitChanges.Find(ForInstigator))
+	{
+		Existing->NewBest = NewBest;
+	}
+	else
+	{
+		QueuedBestFitChanges.Add(ForInstigator, { OldBest, NewBest });
+	}
+}
+
+void UBDC_InteractionSubsystem::DispatchQueuedEventsUnlessBatched()
+{
+	const UBDC_InteractionSettings* Settings = GetDefault<UBDC_InteractionSettings>();
+	if (!Settings || !Settings->bBatchInteractionEvents)
+	{
+		FlushInteractionEvents();
+	}
+}
+
+void UBDC_InteractionSubsystem::FlushInteractionEvents()
+{
+	if (bFlushingEvents || !HasQueuedInteractionEvents()) return;
+
+	BDC_INTERACTION_SCOPE(Broadcast);
+	TGuardValue<bool> FlushGuard(bFlushingEvents, true);
+
+	// Listeners may update interactions again; those changes queue up for the next flush.
+	Swap(QueuedFieldChanges, FlushingFieldChanges);
+	Swap(QueuedBestFitChanges, FlushingBestFitChanges);
+	FoundReceiversScratch.Reset();
+	LostReceiversScratch.Reset();
+	int32 NumDelegatesFired = 0;
+
+	// Listeners may unregister components mid-flush, so every entry is checked before it is touched.
+	auto IsLiveReceiver = [this](UInteractionReceiverComponent* ReceiverComp) { return ReceiverComp && ReceiverCache.FindSlot(ReceiverComp) != INDEX_NONE; };
+	auto IsLiveInstigator = [this](UInteractionInstigatorComponent* InstigatorComp) { return !InstigatorComp || InstigatorLookup.Contains(InstigatorComp); };
+
+	for (const TPair<TPair<UInteractionInstigatorComponent*, UInteractionReceiverComponent*>, int32>& Change : FlushingFieldChanges)
+	{
+		UInteractionInstigatorComponent* ChangeInstigator = Change.Key.Key;
+		UInteractionReceiverComponent* ReceiverComp = Change.Key.Value;
+		if (Change.Value <= 0 || !IsLiveReceiver(ReceiverComp) || !IsLiveInstigator(ChangeInstigator)) continue;
+		FoundReceiversScratch.Add(ReceiverComp);
+
+		if (ReceiverComp->OnEntersInteractionField.IsBound())
+		{
+			ReceiverComp->OnEntersInteractionField.Broadcast(ChangeInstigator ? ChangeInstigator->GetOwner() : nullptr, ChangeInstigator ? ChangeInstigator->NameOfInstigator : NAME_None);
+			++NumDelegatesFired;
+		}
+		OnFieldChangedNative.Broadcast(ChangeInstigator, ReceiverComp, true);
+	}
+
+	for (const TPair<UInteractionInstigatorComponent*, FInteractionQueuedBestFit>& Change : FlushingBestFitChanges)
+	{
+		const FInteractionQueuedBestFit& BestFit = Change.Value;
+		if (BestFit.OldBest == BestFit.NewBest || !IsLiveInstigator(Change.Key)) continue;
+
+		UInteractionReceiverComponent* OldBest = IsLiveReceiver(BestFit.OldBest) ? BestFit.OldBest : nullptr;
+		UInteractionReceiverComponent* NewBest = IsLiveReceiver(BestFit.NewBest) ? BestFit.NewBest : nullptr;
+
+		if (OldBest && OldBest->OnIsNotBestFitting.IsBound())
+		{
+			OldBest->OnIsNotBestFitting.Broadcast();
+			++NumDelegatesFired;
+		}
+
+		if (NewBest && NewBest->OnIsBestFitting.IsBound())
+		{
+			NewBest->OnIsBestFitting.Broadcast();
+			++NumDelegatesFired;
+		}
+		OnBestFittingChangedNative.Broadcast(Change.Key, OldBest, NewBest);
+	}
+
+	for (const TPair<TPair<UInteractionInstigatorComponent*, UInteractionReceiverComponent*>, int32>& Change : FlushingFieldChanges)
+	{
+		UInteractionInstigatorComponent* ChangeInstigator = Change.Key.Key;
+		UInteractionReceiverComponent* ReceiverComp = Change.Key.Value;
+		if (Change.Value >= 0 || !IsLiveReceiver(ReceiverComp) || !IsLiveInstigator(ChangeInstigator)) continue;
+		LostReceiversScratch.Add(ReceiverComp);
+
+		if (ReceiverComp->OnLeavesInteractionField.IsBound())
+		{
+			ReceiverComp->OnLeavesInteractionField.Broadcast(ChangeInstigator ? ChangeInstigator->GetOwner() : nullptr, ChangeInstigator ? ChangeInstigator->NameOfInstigator : NAME_None);
+			++NumDelegatesFired;
+		}
+		OnFieldChangedNative.Broadcast(ChangeInstigator, ReceiverComp, false);
+	}
+
+	if (FoundReceiversScratch.Num() > 0)
+	{
+		if (OnFoundReceivers.IsBound())
+		{
+			OnFoundReceivers.Broadcast(FoundReceiversScratch);
+			++NumDelegatesFired;
+		}
+		OnFoundReceiversNative.Broadcast(FoundReceiversScratch);
+	}
+
+	if (LostReceiversScratch.Num() > 0)
+	{
+		if (OnLostReceivers.IsBound())
+		{
+			OnLostReceivers.Broadcast(LostReceiversScratch);
+			++NumDelegatesFired;
+		}
+		OnLostReceiversNative.Broadcast(LostReceiversScratch);
+	}
+
+	FlushingFieldChanges.Reset();
+	FlushingBestFitChanges.Reset();
+	BDC_INTERACTION_COUNT(DelegatesFired, NumDelegatesFired);
+}
+
+struct FInteractionConeQuery
+{
+	double OriginX = 0.0;
+	double OriginY = 0.0;
+	float ForwardX = 0.0f;
+	float ForwardY = 0.0f;
+	float MinDotProduct = 0.0f;
+	float GlobalRange = 0.0f;
+};
+
+static void WriteCandidateResult(const FInteractionReceiverCache& Cache, float GlobalRange, FInteractionCandidate& Candidate, float DistanceSquared, float Facing, bool bInRange, bool bInView)
+{
+	Candidate.bInRange = bInRange;
+	Candidate.bInView = bInRange && bInView;
+	if (bInRange)
+	{
+		// Only survivors pay for the per-candidate copy the narrow phase and scoring read.
+		const int32 Slot = Candidate.Slot;
+		const float Distance = FMath::Sqrt(DistanceSquared);
+		Candidate.Location = Cache.GetLocation(Slot);
+		Candidate.Radius = Cache.Radius[Slot];
+		Candidate.Range = Cache.RangeOverride[Slot] > 0.0f ? Cache.RangeOverride[Slot] : GlobalRange;
+		Candidate.Flags = Cache.Flags[Slot];
+		Candidate.EffectiveDistance = FMath::Max(0.0f, Distance - Candidate.Radius);
+		Candidate.ViewCosine = Distance > UE_SMALL_NUMBER ? Facing / Distance : 1.0f;
+	}
+	else
+	{
+		Candidate.EffectiveDistance = MAX_flt;
+		Candidate.ViewCosine = -1.0f;
+	}
+}
+
+/** Range and cone test straight over the receiver cache, gathering four slots per register. */
+static void EvaluateCandidateRange(const FInteractionConeQuery& Query, const FInteractionReceiverCache& Cache, TArrayView<FInteractionCandidate> Candidates, int32 StartIndex, int32 EndIndex)
+{
+	const bool bNarrowCone = Query.MinDotProduct > 0.0f;
+	const float MinDotSquared = Query.MinDotProduct * Query.MinDotProduct;
+
+	const VectorRegister4Float ForwardX = VectorSetFloat1(Query.ForwardX);
+	const VectorRegister4Float ForwardY = VectorSetFloat1(Query.ForwardY);
+	const VectorRegister4Float ConeFactor = VectorSetFloat1(MinDotSquared);
+	const VectorRegister4Float GlobalRange = VectorSetFloat1(Query.GlobalRange);
+	const VectorRegister4Float Zero = VectorZeroFloat();
+
+	const double* PosX = Cache.PosX.GetData();
+	const double* PosY = Cache.PosY.GetData();
+	const float* Radius = Cache.Radius.GetData();
+	const float* RangeOverride = Cache.RangeOverride.GetData();
+
+	int32 Index = StartIndex;
+	for (; Index + 4 <= EndIndex; Index += 4)
+	{
+		// Candidates dropped by a sliced sweep's revalidation read slot 0 and are masked out below.
+		int32 Slots[4];
+		int32 ValidMask = 0;
+		for (int32 Lane = 0; Lane < 4; ++Lane)
+		{
+			const FInteractionCandidate& Candidate = Candidates[Index + Lane];
+			Slots[Lane] = Candidate.Receiver ? Candidate.Slot : 0;
+			ValidMask |= Candidate.Receiver ? 1 << Lane : 0;
+		}
+		if (ValidMask == 0)
+		{
+			for (int32 Lane = 0; Lane < 4; ++Lane)
+			{
+				WriteCandidateResult(Cache, Query.GlobalRange, Candidates[Index + Lane], 0.0f, 0.0f, false, false);
+			}
+			continue;
+		}
+
+		// Offsets to the instigator are taken in double and only then narrowed, so far from the origin they keep full precision.
+		const VectorRegister4Float DeltaX = MakeVectorRegisterFloat(
+			static_cast<float>(PosX[Slots[0]] - Query.OriginX), static_cast<float>(PosX[Slots[1]] - Query.OriginX),
+			static_cast<float>(PosX[Slots[2]] - Query.OriginX), static_cast<float>(PosX[Slots[3]] - Query.OriginX));
+		const VectorRegister4Float DeltaY = MakeVectorRegisterFloat(
+			static_cast<float>(PosY[Slots[0]] - Query.OriginY), static_cast<float>(PosY[Slots[1]] - Query.OriginY),
+			static_cast<float>(PosY[Slots[2]] - Query.OriginY), static_cast<float>(PosY[Slots[3]] - Query.OriginY));
+		const VectorRegister4Float LaneRadius = MakeVectorRegisterFloat(Radius[Slots[0]], Radius[Slots[1]], Radius[Slots[2]], Radius[Slots[3]]);
+		const VectorRegister4Float Override = MakeVectorRegisterFloat(RangeOverride[Slots[0]], RangeOverride[Slots[1]], RangeOverride[Slots[2]], RangeOverride[Slots[3]]);
+
+		const VectorRegister4Float DistanceSquared = VectorMultiplyAdd(DeltaX, DeltaX, VectorMultiply(DeltaY, DeltaY));
+		const VectorRegister4Float Reach = VectorAdd(VectorSelect(VectorCompareGT(Override, Zero), Override, GlobalRange), LaneRadius);
+		const VectorRegister4Float Facing = VectorMultiplyAdd(DeltaX, ForwardX, VectorMultiply(DeltaY, ForwardY));
+		const VectorRegister4Float FacingSquared = VectorMultiply(Facing, Facing);
+		const VectorRegister4Float ConeSquared = VectorMultiply(ConeFactor, DistanceSquared);
+
+		const int32 RangeMask = ValidMask & VectorMaskBits(VectorCompareLE(DistanceSquared, VectorMultiply(Reach, Reach)));
+		const int32 FacingMask = VectorMaskBits(VectorCompareGE(Facing, Zero));
+		const int32 ViewMask = bNarrowCone
+			? FacingMask & VectorMaskBits(VectorCompareGE(FacingSquared, ConeSquared)) & VectorMaskBits(VectorCompareGT(DistanceSquared, Zero))
+			: FacingMask | VectorMaskBits(VectorCompareLE(FacingSquared, ConeSquared));
+
+		float DistanceLanes[4];
+		float FacingLanes[4];
+		VectorStore(DistanceSquared, DistanceLanes);
+		VectorStore(Facing, FacingLanes);
+
+		for (int32 Lane = 0; Lane < 4; ++Lane)
+		{
+			WriteCandidateResult(Cache, Query.GlobalRange, Candidates[Index + Lane], DistanceLanes[Lane], FacingLanes[Lane], (RangeMask >> Lane) & 1, (ViewMask >> Lane) & 1);
+		}
+	}
+
+	for (; Index < EndIndex; ++Index)
+	{
+		FInteractionCandidate& Candidate = Candidates[Index];
+		if (!Candidate.Receiver)
+		{
+			WriteCandidateResult(Cache, Query.GlobalRange, Candidate, 0.0f, 0.0f, false, false);
+			continue;
+		}
+
+		const int32 Slot = Candidate.Slot;
+		const float DeltaX = static_cast<float>(PosX[Slot] - Query.OriginX);
+		const float DeltaY = static_cast<float>(PosY[Slot] - Query.OriginY);
+		const float DistanceSquared = DeltaX * DeltaX + DeltaY * DeltaY;
+		const float Reach = (RangeOverride[Slot] > 0.0f ? RangeOverride[Slot] : Query.GlobalRange) + Radius[Slot];
+		const float Facing = DeltaX * Query.ForwardX + DeltaY * Query.ForwardY;
+		const float ConeSquared = MinDotSquared * DistanceSquared;
+
+		const bool bInView = bNarrowCone
+			? Facing >= 0.0f && Facing * Facing >= ConeSquared && DistanceSquared > 0.0f
+			: Facing >= 0.0f || Facing * Facing <= ConeSquared;
+
+		WriteCandidateResult(Cache, Query.GlobalRange, Candidate, DistanceSquared, Facing, DistanceSquared <= Reach * Reach, bInView);
+	}
+}
+
+void UBDC_InteractionSubsystem::EvaluateCandidates(const UBDC_InteractionSettings* Settings, const FVector& InstigatorLocation, const FVector& InstigatorForward, TArrayView<FInteractionCandidate> Candidates)
+{
+	BDC_INTERACTION_SCOPE(FoV);
+
+	const int32 NumCandidates = Candidates.Num();
+	BDC_INTERACTION_COUNT(ReceiversScanned, NumCandidates);
+
+	FInteractionConeQuery Query;
+	Query.OriginX = InstigatorLocation.X;
+	Query.OriginY = InstigatorLocation.Y;
+	Query.ForwardX = static_cast<float>(InstigatorForward.X);
+	Query.ForwardY = static_cast<float>(InstigatorForward.Y);
+	Query.MinDotProduct = FMath::Cos(FMath::DegreesToRadians(Settings->InteractionFoV * 0.5f));
+	Query.GlobalRange = Settings->InteractionRange;
+
+	const int32 BatchSize = FMath::Max(4, Align(CVarInteractionParallelBatchSize.GetValueOnGameThread(), 4));
+	const int32 ParallelThreshold = CVarInteractionParallelThreshold.GetValueOnGameThread();
+
+	if (ParallelThreshold < 0 || NumCandidates < ParallelThreshold || NumCandidates <= BatchSize)
+	{
+		EvaluateCandidateRange(Query, ReceiverCache, Candidates, 0, NumCandidates);
+	}
+	else
+	{
+		const FInteractionReceiverCache& Cache = ReceiverCache;
+		const int32 NumBatches = FMath::DivideAndRoundUp(NumCandidates, BatchSize);
+		ParallelFor(NumBatches, [&Query, &Cache, Candidates, BatchSize, NumCandidates](int32 BatchIndex)
+		{
+			const int32 StartIndex = BatchIndex * BatchSize;
+			EvaluateCandidateRange(Query, Cache, Candidates, StartIndex, FMath::Min(StartIndex + BatchSize, NumCandidates));
+		});
+	}
+
+	RefineCandidates(InstigatorLocation, Candidates);
+}
+
+void UBDC_InteractionSubsystem::RefineCandidates(const FVector& InstigatorLocation, TArrayView<FInteractionCandidate> Candidates) const
+{
+	for (FInteractionCandidate& Candidate : Candidates)
+	{
+		if (!Candidate.bInRange || !EnumHasAnyFlags(Candidate.Flags, EInteractionReceiverFlags::NarrowPhaseMask)) continue;
+
+		bool bInRange = true;
+		if (EnumHasAnyFlags(Candidate.Flags, EInteractionReceiverFlags::VerticalLimit))
+		{
+			bInRange = FMath::Abs(InstigatorLocation.Z - Candidate.Location.Z) <= ReceiverCache.MaxVerticalDistance[Candidate.Slot];
+		}
+
+		if (bInRange && EnumHasAnyFlags(Candidate.Flags, EInteractionReceiverFlags::ShapeCapsule | EInteractionReceiverFlags::ShapeBox))
+		{
+			float Distance;
+			if (EnumHasAnyFlags(Candidate.Flags, EInteractionReceiverFlags::ShapeBox))
+			{
+				// Clamped in the box's own frame, like the occluder test, so a rotated box is not measured by its larger AABB.
+				const FTransform& BoxTransform = ReceiverCache.ShapeTransforms[Candidate.Slot];
+				const FVector& Extent = ReceiverCache.BoxExtents[Candidate.Slot];
+				const FVector LocalClosest = BoxTransform.InverseTransformPosition(InstigatorLocation).BoundToBox(-Extent, Extent);
+				Distance = static_cast<float>(FVector::Dist(InstigatorLocation, BoxTransform.TransformPosition(LocalClosest)));
+			}
+			else
+			{
+				const FBox& Bounds = ReceiverCache.ShapeBounds[Candidate.Slot];
+				// The capsule is upright, so its core segment runs along the centre of its AABB.
+				const FVector Center = Bounds.GetCenter();
+				const double CoreHalfHeight = FMath::Max(0.0, Bounds.GetExtent().Z - Candidate.Radius);
+				const FVector SegmentStart(Center.X, Center.Y, Center.Z - CoreHalfHeight);
+				const FVector SegmentEnd(Center.X, Center.Y, Center.Z + CoreHalfHeight);
+				Distance = FMath::Max(0.0f, static_cast<float>(FMath::PointDistToSegment(InstigatorLocation, SegmentStart, SegmentEnd)) - Candidate.Radius);
+			}
+
+			bInRange = Distance <= Candidate.Range;
+			Candidate.EffectiveDistance = Distance;
+		}
+
+		if (!bInRange)
+		{
+			Candidate.bInRange = false;
+			Candidate.bInView = false;
+			Candidate.EffectiveDistance = MAX_flt;
+		}
+	}
+}
+
+void UBDC_InteractionSubsystem::UpdateScratchMemoryStat() const
+{
+#if STATS || CSV_PROFILER
+	SIZE_T ScratchBytes = CandidateScratch.GetAllocatedSize()
+		+ GridQueryScratch.GetAllocatedSize()
+		+ AddedReceiversScratch.GetAllocatedSize()
+		+ RemovedReceiversScratch.GetAllocatedSize()
+		+ InstigatorScratch.GetAllocatedSize()
+		+ FoundReceiversScratch.GetAllocatedSize()
+		+ LostReceiversScratch.GetAllocatedSize()
+		+ QueuedFieldChanges.GetAllocatedSize()
+		+ FlushingFieldChanges.GetAllocatedSize();
+
+	for (const TPair<UInteractionInstigatorComponent*, FInstigatorInteractionState>& Pair : InstigatorStates)
+	{
+		const FInstigatorInteractionState& State = Pair.Value;
+		ScratchBytes += State.PendingReceiversInField.GetAllocatedSize()
+			+ State.PendingFieldSlots.GetAllocatedSize()
+			+ State.PendingReceiversInView.GetAllocatedSize()
+			+ State.PendingViewEntries.GetAllocatedSize()
+			+ State.SweepCandidates.GetAllocatedSize();
+	}
+
+	SET_MEMORY_STAT(STAT_BDCInteraction_ScratchMemory, ScratchBytes);
+	CSV_CUSTOM_STAT(BDCInteraction, ScratchMemoryKB, static_cast<float>(ScratchBytes / 1024.0), ECsvCustomStatOp::Set);
+#endif
+}
+
+void UBDC_InteractionSubsystem::DrawDebugInstigators(const UWorld* World, const UBDC_InteractionSettings* Settings) const
+{
+	BDC_INTERACTION_SCOPE(DebugDraw);
+
+	for (UInteractionInstigatorComponent* InstigatorComp : InstigatorsOfLevel)
+	{
+		if (InstigatorComp && InstigatorComp->bShowDebugging)
+		{
+			const FVector CurrentInstigatorLocation = InstigatorComp->GetInstigatorTransform().GetLocation();
+			FRotator CurrentInstigatorRotation = InstigatorComp->GetInstigatorTransform().Rotator();
+			CurrentInstigatorRotation.Yaw += InstigatorComp->InstigatorOffsetViewRotation;
+
+			const FVector DebugLocation = CurrentInstigatorLocation + FVector(0, 0, 10);
+
+			DrawDebugCircle(World, DebugLocation, Settings->InteractionRange, 36, FColor::Yellow, false, -1, 0, 2, FVector(1, 0, 0), FVector(0, 1, 0), false);
+
+			const float HalfFoVInDegrees = Settings->InteractionFoV * 0.5f;
+			const FVector Forward = CurrentInstigatorRotation.Vector();
+			const FVector RightBound = Forward.RotateAngleAxis(HalfFoVInDegrees, FVector::UpVector);
+			const FVector LeftBound = Forward.RotateAngleAxis(-HalfFoVInDegrees, FVector::UpVector);
+
+			DrawDebugLine(World, DebugLocation, DebugLocation + RightBound * Settings->InteractionRange, FColor::Red, false, -1, 0, 2);
+			DrawDebugLine(World, DebugLocation, DebugLocation + LeftBound * Settings->InteractionRange, FColor::Red, false, -1, 0, 2);
+
+			constexpr int32 ArcSegments = 12;
+			FVector LastPoint = DebugLocation + LeftBound * Settings->InteractionRange;
+			for (int32 i = 1; i <= ArcSegments; ++i)
+			{
+				const float CurrentAngle = -HalfFoVInDegrees + (Settings->InteractionFoV * i / ArcSegments);
+				const FVector CurrentPoint = DebugLocation + Forward.RotateAngleAxis(CurrentAngle, FVector::UpVector) * Settings->InteractionRange;
+				DrawDebugLine(World, LastPoint, CurrentPoint, FColor::Red, false, -1, 0, 2);
+				LastPoint = CurrentPoint;
+			}
+		}
+	}
+}
+
+/** True only when the segment passes through a solid occluder box that contains neither end point. */
+static bool IsCoarselyOccluded(TConstArrayView<const FInteractionOccluder*> NearbyOccluders, const FVector& From, const FVector& To, const AActor* ReceiverActor, const AActor* InstigatorActor)
+{
+	if (NearbyOccluders.Num() == 0) return false;
+
+	const FBox SegmentBounds = FBox(From, From) + To;
+	for (const FInteractionOccluder* Occluder : NearbyOccluders)
+	{
+		if (Occluder->Owner == ReceiverActor || Occluder->Owner == InstigatorActor) continue;
+		if (!Occluder->Bounds.Intersect(SegmentBounds)) continue;
+
+		const FVector LocalFrom = Occluder->Transform.InverseTransformPosition(From);
+		const FVector LocalTo = Occluder->Transform.InverseTransformPosition(To);
+		const FBox LocalBox(-Occluder->Extent, Occluder->Extent);
+
+		if (LocalBox.IsInside(LocalFrom) || LocalBox.IsInside(LocalTo)) continue;
+
+		if (FMath::LineBoxIntersection(LocalBox, LocalFrom, LocalTo, LocalTo - LocalFrom))
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+bool UBDC_InteractionSubsystem::HasLineOfSight(UWorld* World, const UBDC_InteractionSettings* Settings, FInstigatorInteractionState& State, const FVector& From, const FInteractionReceiverHandle& ReceiverHandle, UInteractionReceiverComponent* ReceiverComp, const FVector& ReceiverLocation, AActor* InstigatorActor, TConstArrayView<const FInteractionOccluder*> NearbyOccluders, bool bBlockingLineOfSight)
+{
+	BDC_INTERACTION_SCOPE(Traces);
+
+	const FIntVector InstigatorCell = QuantizeInstigatorLocation(Settings, From);
+
+	if (Settings->bCacheLineOfSight && !bBlockingLineOfSight)
+	{
+		if (const FInteractionLineOfSightCacheEntry* Entry = State.LineOfSightCache.Find(ReceiverHandle))
+		{
+			if (Entry->InstigatorCell == InstigatorCell && World->GetTimeSeconds() - Entry->Timestamp <= Settings->LineOfSightCacheLifetime)
+			{
+				BDC_INTERACTION_COUNT(CacheHits, 1);
+				return Entry->bLineOfSightClear;
+			}
+		}
+	}
+
+	if (IsCoarselyOccluded(NearbyOccluders, From, ReceiverLocation, ReceiverComp->GetOwner(), InstigatorActor))
+	{
+		BDC_INTERACTION_COUNT(TracesSaved, 1);
+		return false;
+	}
+
+	FCollisionQueryParams TraceParams(FName(TEXT("UpdateInteractionTrace")), true, InstigatorActor);
+
+	if (Settings->bUseAsyncLineOfSight && !bBlockingLineOfSight)
+	{
+		// Throttled or time-sliced updates can be many frames apart, so freshness is counted in sweeps of this
+		// instigator: a result is usable if it landed during the previous sweep or the current one.
+		FInteractionLineOfSightResult& Result = State.AsyncLineOfSightResults.FindOrAdd(ReceiverHandle);
+		if (!Result.bTracePending || Result.IssuedSweep + 1 < State.SweepSerial)
+		{
+			const FTraceDelegate TraceDelegate = FTraceDelegate::CreateUObject(this, &UBDC_InteractionSubsystem::OnLineOfSightTraceDone, ReceiverHandle, State.Instigator, InstigatorCell);
+			World->AsyncLineTraceByChannel(EAsyncTraceType::Single, From, ReceiverLocation, ECC_Visibility, TraceParams, FCollisionResponseParams::DefaultResponseParam, &TraceDelegate);
+			Result.bTracePending = true;
+			Result.IssuedSweep = State.SweepSerial;
+			BDC_INTERACTION_COUNT(TracesIssued, 1);
+		}
+
+		return Result.ResultSweep != 0 && Result.ResultSweep + 1 >= State.SweepSerial && Result.bLineOfSightClear;
+	}
+
+	BDC_INTERACTION_COUNT(TracesIssued, 1);
+
+	FHitResult HitResult;
+	const bool bHit = World->LineTraceSingleByChannel(HitResult, From, ReceiverLocation, ECC_Visibility, TraceParams);
+	const bool bLineOfSightClear = !bHit || HitResult.GetActor() == ReceiverComp->GetOwner();
+
+	if (Settings->bCacheLineOfSight)
+	{
+		FInteractionLineOfSightCacheEntry& Entry = State.LineOfSightCache.FindOrAdd(ReceiverHandle);
+		Entry.InstigatorCell = InstigatorCell;
+		Entry.bLineOfSightClear = bLineOfSightClear;
+		Entry.Timestamp = World->GetTimeSeconds();
+	}
+
+	if (Settings->bUseAsyncLineOfSight)
+	{
+		// A blocking validation still counts as a sweep, so its result has to stand in for the async one as well.
+		FInteractionLineOfSightResult& Result = State.AsyncLineOfSightResults.FindOrAdd(ReceiverHandle);
+		Result.bLineOfSightClear = bLineOfSightClear;
+		Result.ResultSweep = State.SweepSerial;
+	}
+
+	return bLineOfSightClear;
+}
+
+FIntVector UBDC_InteractionSubsystem::QuantizeInstigatorLocation(const UBDC_InteractionSettings* Settings, const FVector& Location)
+{
+	const float Step = FMath::Max(1.0f, Settings->LineOfSightCacheQuantization);
+	return FIntVector(FMath::FloorToInt(Location.X / Step), FMath::FloorToInt(Location.Y / Step), FMath::FloorToInt(Location.Z / Step));
+}
+
+void UBDC_InteractionSubsystem::OnLineOfSightTraceDone(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum, FInteractionReceiverHandle ReceiverHandle, UInteractionInstigatorComponent* StateKey, FIntVector InstigatorCell)
+{
+	const UInteractionReceiverComponent* ReceiverComp = ReceiverCache.Resolve(ReceiverHandle);
+	if (!ReceiverComp) return;
+
+	FInstigatorInteractionState* State = InstigatorStates.Find(StateKey);
+	if (!State) return;
+
+	bool bLineOfSightClear = true;
+	for (const FHitResult& Hit : TraceDatum.OutHits)
+	{
+		if (Hit.bBlockingHit)
+		{
+			bLineOfSightClear = Hit.GetActor() == ReceiverComp->GetOwner();
+			break;
+		}
+	}
+
+	FInteractionLineOfSightResult& Result = State->AsyncLineOfSightResults.FindOrAdd(ReceiverHandle);
+	Result.bLineOfSightClear = bLineOfSightClear;
+	Result.bTracePending = false;
+	Result.ResultSweep = State->SweepSerial;
+
+	const UBDC_InteractionSettings* Settings = GetDefault<UBDC_InteractionSettings>();
+	if (const UWorld* World = GetWorld(); Settings && World && Settings->bCacheLineOfSight)
+	{
+		FInteractionLineOfSightCacheEntry& Entry = State->LineOfSightCache.FindOrAdd(ReceiverHandle);
+		Entry.InstigatorCell = InstigatorCell;
+		Entry.bLineOfSightClear = bLineOfSightClear;
+		Entry.Timestamp = World->GetTimeSeconds();
+	}
+}
+
+void UBDC_InteractionSubsystem::GetAllReceiversField(TArray<UInteractionReceiverComponent*>& Receivers) const
+{
+	GetAllReceiversFieldOf(Instigator, Receivers);
+}
+
+void UBDC_InteractionSubsystem::GetAllReceiversFieldOf(UInteractionInstigatorComponent* ForInstigator, TArray<UInteractionReceiverComponent*>& Receivers) const
+{
+	if (const FInstigatorInteractionState* State = FindState(ForInstigator))
+	{
+		Receivers = State->ReceiversInField;
+		return;
+	}
+	Receivers.Reset();
+}
+
+void UBDC_InteractionSubsystem::GetAllReceiversOfLevel(TArray<FInteractionReceivers>& Receivers) const
+{
+	Receivers.Reset(ReceiverGrid.Num());
+	for (const FInteractionReceivers& Entry : ReceiversOfLevel)
+	{
+		if (Entry.InteractionComponent)
+		{
+			Receivers.Add(Entry);
+		}
+	}
+}
+
+void UBDC_InteractionSubsystem::GetReceiverByTag(FGameplayTag OfReceiverTag, FInteractionReceivers& ReceiverData) const
+{
+	ReceiverData = FInteractionReceivers();
+	if (UInteractionReceiverComponent* Comp = ReceiverLookup.FindFirstByTag(OfReceiverTag))
+	{
+		ReceiverData.InteractionActor = Comp->GetOwner();
+		ReceiverData.InteractionComponent = Comp;
+	}
+}
+
+void UBDC_InteractionSubsystem::GetReceiverByName(FName OfReceiverName, FInteractionReceivers& ReceiverData) const
+{
+	ReceiverData = FInteractionReceivers();
+	if (UInteractionReceiverComponent* Comp = ReceiverLookup.FindFirstByName(OfReceiverName))
+	{
+		ReceiverData.InteractionActor = Comp->GetOwner();
+		ReceiverData.InteractionComponent = Comp;
+	}
+}
+
+void UBDC_InteractionSubsystem::GetInstigatorByTag(FGameplayTag OfInstigatorTag, FInteractionReceivers& InstigatorData) const
+{
+	InstigatorData = FInteractionReceivers();
+	if (UInteractionInstigatorComponent* I = InstigatorLookup.FindFirstByTag(OfInstigatorTag))
+	{
+		InstigatorData.InteractionActor = I->GetOwner();
+		InstigatorData.InteractionComponent = I;
+	}
+}
+
+void UBDC_InteractionSubsystem::GetInstigatorByName(FName OfInstigatorName, FInteractionReceivers& InstigatorData) const
+{
+	InstigatorData = FInteractionReceivers();
+	if (UInteractionInstigatorComponent* I = InstigatorLookup.FindFirstByName(OfInstigatorName))
+	{
+		InstigatorData.InteractionActor = I->GetOwner();
+		InstigatorData.InteractionComponent = I;
+	}
+}
+
+void UBDC_InteractionSubsystem::GetReceiversByName(FName OfReceiverName, TArray<FInteractionReceivers>& OutReceivers) const
+{
+	const TConstArrayView<UInteractionReceiverComponent*> Matches = ReceiverLookup.FindAllByName(OfReceiverName);
+
+	OutReceivers.Reset(Matches.Num());
+	for (UInteractionReceiverComponent* Comp : Matches)
+	{
+		FInteractionReceivers& Entry = OutReceivers.AddDefaulted_GetRef();
+		Entry.InteractionActor = Comp->GetOwner();
+		Entry.InteractionComponent = Comp;
+	}
+}
+
+void UBDC_InteractionSubsystem::GetReceiversByTag(FGameplayTag OfReceiverTag, bool bIncludeChildTags, TArray<FInteractionReceivers>& OutReceivers) const
+{
+	const TConstArrayView<UInteractionReceiverComponent*> Matches = ReceiverLookup.FindAllByTag(OfReceiverTag, bIncludeChildTags);
+
+	OutReceivers.Reset(Matches.Num());
+	for (UInteractionReceiverComponent* Comp : Matches)
+	{
+		FInteractionReceivers& Entry = OutReceivers.AddDefaulted_GetRef();
+		Entry.InteractionActor = Comp->GetOwner();
+		Entry.InteractionComponent = Comp;
+	}
+}
+
+void UBDC_InteractionSubsystem::GetInstigatorsByTag(FGameplayTag OfInstigatorTag, bool bIncludeChildTags, TArray<FInteractionReceivers>& OutInstigators) const
+{
+	const TConstArrayView<UInteractionInstigatorComponent*> Matches = InstigatorLookup.FindAllByTag(OfInstigatorTag, bIncludeChildTags);
+
+	OutInstigators.Reset(Matches.Num());
+	for (UInteractionInstigatorComponent* I : Matches)
+	{
+		FInteractionReceivers& Entry = OutInstigators.AddDefaulted_GetRef();
+		Entry.InteractionActor = I->GetOwner();
+		Entry.InteractionComponent = I;
+	}
+}
+
+void UBDC_InteractionSubsystem::RefreshReceiverLookup(UInteractionReceiverComponent* ReceiverComponent)
+{
+	if (ReceiverComponent && ReceiverLookup.Contains(ReceiverComponent))
+	{
+		ReceiverLookup.Add(ReceiverComponent, ReceiverComponent->NameOfReceiver, ReceiverComponent->TagOfReceiver);
+	}
+}
+
+void UBDC_InteractionSubsystem::RefreshInstigatorLookup(UInteractionInstigatorComponent* InstigatorComponent)
+{
+	if (InstigatorComponent && InstigatorLookup.Contains(InstigatorComponent))
+	{
+		InstigatorLookup.Add(InstigatorComponent, InstigatorComponent->NameOfInstigator, InstigatorComponent->TagOfInstigator);
+	}
+}
+
+template <typename PredicateType>
+static void RemoveFieldEntries(TArray<UInteractionReceiverComponent*>& Receivers, TArray<int32>& Slots, PredicateType&& ShouldRemoveSlot, TArray<UInteractionReceiverComponent*>* OutRemoved = nullptr)
+{
+	int32 WriteIndex = 0;
+	for (int32 ReadIndex = 0; ReadIndex < Receivers.Num(); ++ReadIndex)
+	{
+		if (ShouldRemoveSlot(Slots[ReadIndex]))
+		{
+			if (OutRemoved)
+			{
+				OutRemoved->Add(Receivers[ReadIndex]);
+			}
+			continue;
+		}
+
+		Receivers[WriteIndex] = Receivers[ReadIndex];
+		Slots[WriteIndex] = Slots[ReadIndex];
+		++WriteIndex;
+	}
+	Receivers.SetNum(WriteIndex);
+	Slots.SetNum(WriteIndex);
+}
+
+void UBDC_InteractionSubsystem::AddReceiver(FInteractionReceivers NewReceiver)
+{
+	if (UInteractionReceiverComponent* ReceiverComp = Cast<UInteractionReceiverComponent>(NewReceiver.InteractionComponent))
+	{
+		RegisterReceiverInternal(ReceiverComp, NewReceiver.InteractionActor);
+	}
+}
+
+void UBDC_InteractionSubsystem::RemoveReceiver(UInteractionReceiverComponent* ReceiverComponent)
+{
+	UnregisterReceivers(MakeArrayView(&ReceiverComponent, 1));
+}
+
+int32 UBDC_InteractionSubsystem::RegisterReceiverInternal(UInteractionReceiverComponent* ReceiverComp, AActor* ReceiverActor)
+{
+	const FTransform ReceiverTransform = ReceiverComp->GetReceiverTransform();
+	const FVector ReceiverLocation = ReceiverTransform.GetLocation();
+	const bool bNewReceiver = ReceiverCache.FindSlot(ReceiverComp) == INDEX_NONE;
+	const int32 Slot = ReceiverCache.Add(ReceiverComp, ReceiverLocation, ReceiverComp->ReceiverRadius);
+
+	if (ReceiversOfLevel.Num() <= Slot)
+	{
+		ReceiversOfLevel.SetNum(Slot + 1);
+	}
+	ReceiversOfLevel[Slot].InteractionActor = ReceiverActor;
+	ReceiversOfLevel[Slot].InteractionComponent = ReceiverComp;
+
+	CompileReceiverTagFilter(Slot, ReceiverComp);
+	CompileReceiverShape(Slot, ReceiverComp, ReceiverTransform);
+
+	if (bNewReceiver)
+	{
+		AddToLevelBucket(Slot, ReceiverComp);
+	}
+	if (!ReceiverCache.HasAnyFlags(Slot, EInteractionReceiverFlags::OutOfGridMask))
+	{
+		ReceiverGrid.Add(Slot, ReceiverLocation);
+	}
+	ReceiverLookup.Add(ReceiverComp, ReceiverComp->NameOfReceiver, ReceiverComp->TagOfReceiver);
+
+	if (bNewReceiver && ReceiverComp->IsInteractionDormant())
+	{
+		SetReceiverDormant(ReceiverComp, true);
+	}
+	return Slot;
+}
+
+void UBDC_InteractionSubsystem::RegisterReceivers(TConstArrayView<UInteractionReceiverComponent*> NewReceivers)
+{
+	ReceiverCache.Reserve(ReceiverCache.NumSlots() + NewReceivers.Num());
+	ReceiversOfLevel.Reserve(ReceiverCache.NumSlots() + NewReceivers.Num());
+
+	for (UInteractionReceiverComponent* ReceiverComp : NewReceivers)
+	{
+		if (ReceiverComp)
+		{
+			RegisterReceiverInternal(ReceiverComp, ReceiverComp->GetOwner());
+		}
+	}
+}
+
+void UBDC_InteractionSubsystem::UnregisterReceivers(TConstArrayView<UInteractionReceiverComponent*> ReceiversToRemove)
+{
+	TSet<UInteractionReceiverComponent*> RemovedReceivers;
+	TArray<FInteractionReceiverHandle> RemovedHandles;
+	TBitArray<> RemovedSlots(false, ReceiverCache.NumSlots());
+
+	for (UInteractionReceiverComponent* ReceiverComp : ReceiversToRemove)
+	{
+		const FInteractionReceiverHandle Handle = ReceiverCache.GetHandle(ReceiverCache.FindSlot(ReceiverComp));
+		const int32 Slot = ReceiverCache.Remove(ReceiverComp);
+		if (Slot == INDEX_NONE) continue;
+
+		RemoveFromLevelBucket(Slot);
+		RemoveFromDormantList(Slot);
+
+		ReceiversOfLevel[Slot] = FInteractionReceivers();
+		ReceiverGrid.Remove(Slot);
+		LargeReachSlots.RemoveSingleSwap(Slot, false);
+		ReceiverLookup.Remove(ReceiverComp);
+
+		RemovedReceivers.Add(ReceiverComp);
+		RemovedHandles.Add(Handle);
+		RemovedSlots[Slot] = true;
+	}
+
+	if (RemovedReceivers.Num() == 0) return;
+
+	auto IsRemovedSlot = [&RemovedSlots](int32 Slot) { return RemovedSlots.IsValidIndex(Slot) && RemovedSlots[Slot]; };
+	TArray<UInteractionReceiverComponent*> LeftField;
+	bool bAnyBestRemoved = false;
+
+	for (auto It = QueuedFieldChanges.CreateIterator(); It; ++It)
+	{
+		if (RemovedReceivers.Contains(It.Key().Value))
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	for (TPair<UInteractionInstigatorComponent*, FInstigatorInteractionState>& Pair : InstigatorStates)
+	{
+		FInstigatorInteractionState& State = Pair.Value;
+		LeftField.Reset();
+		RemoveFieldEntries(State.ReceiversInField, State.FieldSlots, IsRemovedSlot, &LeftField);
+		RemoveFieldEntries(State.PendingReceiversInField, State.PendingFieldSlots, IsRemovedSlot);
+		if (State.ReceiversInView.RemoveAll([&RemovedReceivers](const UInteractionReceiverComponent* Receiver) { return RemovedReceivers.Contains(Receiver); }) > 0)
+		{
+			RebuildViewReceivers(State);
+		}
+		State.PendingViewEntries.RemoveAll([&RemovedReceivers](const FInteractionViewEntry& Entry) { return RemovedReceivers.Contains(Entry.Receiver); });
+
+		UInteractionReceiverComponent* BestReceiver = Cast<UInteractionReceiverComponent>(State.CurrentBestFittingReceiver.InteractionComponent);
+		const bool bBestRemoved = BestReceiver && RemovedReceivers.Contains(BestReceiver);
+		if (bBestRemoved)
+		{
+			// The view is still sorted by score, so the runner-up takes over without waiting for the next update.
+			State.CurrentBestFittingReceiver = FInteractionReceivers();
+			State.CurrentBestReceiverIndex = INDEX_NONE;
+			State.bBestHeldByHysteresis = false;
+			QueueBestFitChange(State.Instigator, BestReceiver, nullptr);
+			bAnyBestRemoved = true;
+
+			if (State.ReceiversInView.Num() > 0)
+			{
+				State.CurrentBestReceiverIndex = SelectBestReceiverIndex(State.PendingViewEntries, nullptr);
+				if (UInteractionReceiverComponent* NewBestReceiver = State.ReceiversInView[State.CurrentBestReceiverIndex])
+				{
+					QueueBestFitChange(State.Instigator, BestReceiver, NewBestReceiver);
+					State.CurrentBestFittingReceiver.InteractionComponent = NewBestReceiver;
+					State.CurrentBestFittingReceiver.InteractionActor = NewBestReceiver->GetOwner();
+				}
+			}
+		}
+		else if (BestReceiver)
+		{
+			// Removing entries ahead of the best shifts it down the view.
+			State.CurrentBestReceiverIndex = State.ReceiversInView.IndexOfByKey(BestReceiver);
+		}
+
+		// Only instigators that actually lose a replicated receiver push a delta.
+		if (Pair.Key && (LeftField.Num() > 0 || bBestRemoved))
+		{
+			Pair.Key->ReplicateInteractionState({}, LeftField, Cast<UInteractionReceiverComponent>(State.CurrentBestFittingReceiver.InteractionComponent));
+		}
 
-	UInteractionReceiverComponent* BestReceiver = Cast<UInteractionReceiverComponent>(CurrentBestFittingReceiver.InteractionComponent);
+		for (const FInteractionReceiverHandle& Handle : RemovedHandles)
+		{
+			State.AsyncLineOfSightResults.Remove(Handle);
+			State.LineOfSightCache.Remove(Handle);
+		}
+	}
 
-	if (BestReceiver)
+	if (bAnyBestRemoved)
 	{
-		LastInteractedWith.InteractionComponent = BestReceiver;
-		LastInteractedWith.InteractionActor = BestReceiver->GetOwner();
-
-		BestReceiver->OnReceivedInteraction.Broadcast(Instigator->GetOwner(), Instigator->NameOfInstigator, Instigator->InstigatingTags);
-		OnInteractionFired.Broadcast(BestReceiver);
+		DispatchQueuedEventsUnlessBatched();
 	}
 }
 
-void UBDC_InteractionSubsystem::UpdateInteractions(FVector InstigatorLocation, FRotator InstigatorRotation)
+void UBDC_InteractionSubsystem::AddToLevelBucket(int32 Slot, UInteractionReceiverComponent* ReceiverComp)
 {
-	InstigatorTransform.SetLocation(InstigatorLocation);
-	InstigatorTransform.SetRotation(InstigatorRotation.Quaternion());
-
-	const UBDC_InteractionSettings* Settings = GetDefault<UBDC_InteractionSettings>();
-	const UWorld* World = GetWorld();
-	if (!Settings || !World) return;
-
-	TArray<UInteractionReceiverComponent*> NewReceiversInField;
-	TArray<UInteractionReceiverComponent*> AddedReceivers;
-	TArray<UInteractionReceiverComponent*> RemovedReceivers;
-
-	AActor* InstigatorActor = Instigator ? Instigator->GetOwner() : nullptr;
-
-	if (!Instigator && InstigatorsOfLevel.Num() > 0)
+	if (ReceiverLevelEntries.Num() <= Slot)
 	{
-		Instigator = InstigatorsOfLevel[0];
-		InstigatorActor = Instigator->GetOwner();
+		ReceiverLevelEntries.SetNum(Slot + 1);
 	}
 
-	const FName FinalInstigatorName = Instigator ? Instigator->NameOfInstigator : NAME_None;
+	const ULevel* Level = ReceiverComp->GetComponentLevel();
+	FInteractionLevelBucket& Bucket = LevelBuckets.FindOrAdd(Level);
 
-	for (const FInteractionReceivers& ReceiverData : ReceiversOfLevel)
-	{
-		UInteractionReceiverComponent* ReceiverComp = Cast<UInteractionReceiverComponent>(ReceiverData.InteractionComponent);
-		if (!ReceiverComp) continue;
+	FInteractionReceiverLevelEntry& Entry = ReceiverLevelEntries[Slot];
+	Entry.Level = Level;
+	Entry.BucketIndex = Bucket.Slots.Add(Slot);
 
-		const FVector ReceiverLocation = ReceiverComp->GetReceiverTransform().GetLocation();
-		const float DistanceXY = FVector::DistXY(InstigatorLocation, ReceiverLocation);
+	ReceiverCache.SetFlags(Slot, EInteractionReceiverFlags::LevelInactive, !Bucket.bActive);
+}
 
-		if (const float EffectiveDistanceXY = FMath::Max(0.0f, DistanceXY - ReceiverComp->ReceiverRadius); EffectiveDistanceXY <= Settings->InteractionRange)
-		{
-			FHitResult HitResult;
-			FCollisionQueryParams TraceParams(FName(TEXT("UpdateInteractionTrace")), true, InstigatorActor);
-			
-			const bool bHit = World->LineTraceSingleByChannel(HitResult, InstigatorLocation, ReceiverLocation, ECC_Visibility, TraceParams);
+void UBDC_InteractionSubsystem::RemoveFromLevelBucket(int32 Slot)
+{
+	if (!ReceiverLevelEntries.IsValidIndex(Slot)) return;
 
-			if (const bool bLineOfSightClear = !bHit || HitResult.GetActor() == ReceiverData.InteractionActor)
-			{
-				NewReceiversInField.Add(ReceiverComp);
-				if (!ReceiversInField.Contains(ReceiverComp))
-				{
-					AddedReceivers.Add(ReceiverComp);
-					ReceiverComp->OnEntersInteractionField.Broadcast(InstigatorActor, FinalInstigatorName);
-				}
-			}
-			else if (bHit)
+	FInteractionReceiverLevelEntry& Entry = ReceiverLevelEntries[Slot];
+	if (FInteractionLevelBucket* Bucket = LevelBuckets.Find(Entry.Level))
+	{
+		if (Bucket->Slots.IsValidIndex(Entry.BucketIndex))
+		{
+			Bucket->Slots.RemoveAtSwap(Entry.BucketIndex, 1, false);
+			if (Bucket->Slots.IsValidIndex(Entry.BucketIndex))
 			{
-				// UE_LOG(LogTemp, Warning, TEXT("[Interaction] Trace hit %s instead of %s"), *HitResult.GetActor()->GetName(), *ReceiverData.InteractionActor->GetName());
+				ReceiverLevelEntries[Bucket->Slots[Entry.BucketIndex]].BucketIndex = Entry.BucketIndex;
 			}
 		}
+
+		// Inactive buckets of levels still in the world are kept so receivers registering later still start out inactive.
+		const ULevel* Level = Entry.Level.ResolveObjectPtr();
+		if (Bucket->Slots.Num() == 0 && (Bucket->bActive || !Level || !Level->bIsVisible))
+		{
+			LevelBuckets.Remove(Entry.Level);
+		}
 	}
+	Entry = FInteractionReceiverLevelEntry();
+}
 
-	TArray<UInteractionReceiverComponent*> NewReceiversInView;
-	FRotator AdjustedInstigatorRotation = InstigatorRotation;
-	if (Instigator)
+void UBDC_InteractionSubsystem::SetLevelInteractionActive(const ULevel* Level, bool bActive)
+{
+	FInteractionLevelBucket* Bucket = LevelBuckets.Find(Level);
+	if (!Bucket)
 	{
-		AdjustedInstigatorRotation.Yaw += Instigator->InstigatorOffsetViewRotation;
+		if (bActive) return;
+		Bucket = &LevelBuckets.Add(Level);
 	}
-	const FVector InstigatorForward = AdjustedInstigatorRotation.Vector();
-	const float HalfFoVInRadians = FMath::DegreesToRadians(Settings->InteractionFoV * 0.5f);
-	const float MinDotProduct = FMath::Cos(HalfFoVInRadians);
+	if (Bucket->bActive == bActive) return;
 
-	for (UInteractionReceiverComponent* Receiver : NewReceiversInField)
+	Bucket->bActive = bActive;
+	for (const int32 Slot : Bucket->Slots)
 	{
-		const FVector ReceiverLocation = Receiver->GetReceiverTransform().GetLocation();
-		const FVector DirectionToReceiver = (ReceiverLocation - InstigatorLocation).GetSafeNormal2D();
+		ReceiverCache.SetFlags(Slot, EInteractionReceiverFlags::LevelInactive, !bActive);
 
-		if (const float DotProduct = FVector::DotProduct(InstigatorForward, DirectionToReceiver); DotProduct >= MinDotProduct)
+		if (bActive && !ReceiverCache.HasAnyFlags(Slot, EInteractionReceiverFlags::OutOfGridMask))
 		{
-			NewReceiversInView.Add(Receiver);
+			ReceiverGrid.Add(Slot, ReceiverCache.GetLocation(Slot));
 		}
+		else if (!bActive)
+		{
+			ReceiverGrid.Remove(Slot);
+		}
+	}
+
+	if (bActive && Bucket->Slots.Num() == 0)
+	{
+		LevelBuckets.Remove(Level);
 	}
+}
 
-	NewReceiversInView.Sort([InstigatorLocation](const UInteractionReceiverComponent& A, const UInteractionReceiverComponent& B) {
-		const float DistA = FMath::Max(0.0f, FVector::Dist2D(InstigatorLocation, A.GetReceiverTransform().GetLocation()) - A.ReceiverRadius);
-		const float DistB = FMath::Max(0.0f, FVector::Dist2D(InstigatorLocation, B.GetReceiverTransform().GetLocation()) - B.ReceiverRadius);
-		return DistA < DistB;
-	});
+void UBDC_InteractionSubsystem::SetReceiverDormant(UInteractionReceiverComponent* ReceiverComponent, bool bDormant, float AutoWakeAfterSeconds)
+{
+	const int32 Slot = ReceiverCache.FindSlot(ReceiverComponent);
+	if (Slot == INDEX_NONE) return;
 
-	bool bViewChanged = (ReceiversInView.Num() != NewReceiversInView.Num());
-	if (!bViewChanged)
+	if (!bDormant)
 	{
-		for (int32 Index = 0; Index < ReceiversInView.Num(); ++Index)
+		if (!ReceiverCache.HasFlags(Slot, EInteractionReceiverFlags::Dormant)) return;
+
+		RemoveFromDormantList(Slot);
+		ReceiverCache.SetFlags(Slot, EInteractionReceiverFlags::Dormant, false);
+		if (!ReceiverCache.HasAnyFlags(Slot, EInteractionReceiverFlags::OutOfGridMask))
 		{
-			if (ReceiversInView[Index] != NewReceiversInView[Index])
-			{
-				bViewChanged = true;
-				break;
-			}
+			ReceiverGrid.Add(Slot, ReceiverCache.GetLocation(Slot));
 		}
+		return;
 	}
 
-	ReceiversInView = NewReceiversInView;
+	const UWorld* World = GetWorld();
+	const double WakeTime = AutoWakeAfterSeconds > 0.0f && World ? World->GetTimeSeconds() + AutoWakeAfterSeconds : -1.0;
 
-	UInteractionReceiverComponent* NewBestReceiver = nullptr;
-	if (ReceiversInView.Num() > 0)
+	if (DormantIndices.Num() <= Slot)
 	{
-		if (bViewChanged || !ReceiversInView.IsValidIndex(CurrentBestReceiverIndex))
+		DormantIndices.Init(INDEX_NONE, ReceiverCache.NumSlots());
+		for (int32 Index = 0; Index < DormantReceivers.Num(); ++Index)
 		{
-			CurrentBestReceiverIndex = 0;
+			DormantIndices[DormantReceivers[Index].Slot] = Index;
 		}
-		NewBestReceiver = ReceiversInView[CurrentBestReceiverIndex];
+	}
+
+	if (DormantIndices[Slot] != INDEX_NONE)
+	{
+		DormantReceivers[DormantIndices[Slot]].WakeTime = WakeTime;
 	}
 	else
 	{
-		CurrentBestReceiverIndex = 0;
+		DormantIndices[Slot] = DormantReceivers.Add({ Slot, WakeTime });
+		ReceiverCache.SetFlags(Slot, EInteractionReceiverFlags::Dormant, true);
+		ReceiverGrid.Remove(Slot);
+	}
+
+	if (WakeTime >= 0.0)
+	{
+		NextDormantWakeTime = FMath::Min(NextDormantWakeTime, WakeTime);
+	}
+}
+
+void UBDC_InteractionSubsystem::RemoveFromDormantList(int32 Slot)
+{
+	if (!DormantIndices.IsValidIndex(Slot) || DormantIndices[Slot] == INDEX_NONE) return;
+
+	const int32 Index = DormantIndices[Slot];
+	DormantReceivers.RemoveAtSwap(Index, 1, false);
+	if (DormantReceivers.IsValidIndex(Index))
+	{
+		DormantIndices[DormantReceivers[Index].Slot] = Index;
 	}
+	DormantIndices[Slot] = INDEX_NONE;
+}
+
+void UBDC_InteractionSubsystem::WakeDueReceivers(double CurrentTime)
+{
+	TArray<UInteractionReceiverComponent*, TInlineAllocator<16>> DueReceivers;
+	NextDormantWakeTime = TNumericLimits<double>::Max();
 
-	if (UInteractionReceiverComponent* OldBestReceiver = Cast<UInteractionReceiverComponent>(CurrentBestFittingReceiver.InteractionComponent); OldBestReceiver != NewBestReceiver)
+	for (const FInteractionDormantReceiver& Entry : DormantReceivers)
 	{
-		if (OldBestReceiver)
+		if (Entry.WakeTime < 0.0) continue;
+
+		if (Entry.WakeTime <= CurrentTime)
 		{
-			OldBestReceiver->OnIsNotBestFitting.Broadcast();
+			DueReceivers.Add(ReceiverCache.Receivers[Entry.Slot]);
 		}
-
-		if (NewBestReceiver)
+		else
 		{
-			NewBestReceiver->OnIsBestFitting.Broadcast();
+			NextDormantWakeTime = FMath::Min(NextDormantWakeTime, Entry.WakeTime);
 		}
+	}
 
-		CurrentBestFittingReceiver.InteractionComponent = NewBestReceiver;
-		CurrentBestFittingReceiver.InteractionActor = NewBestReceiver ? NewBestReceiver->GetOwner() : nullptr;
+	// Woken through the component so its own dormant state follows.
+	for (UInteractionReceiverComponent* ReceiverComp : DueReceivers)
+	{
+		ReceiverComp->WakeInteraction();
 	}
+}
 
-	if (Instigator)
+bool UBDC_InteractionSubsystem::IsLevelInteractionActive(const ULevel* Level) const
+{
+	const FInteractionLevelBucket* Bucket = LevelBuckets.Find(Level);
+	return !Bucket || Bucket->bActive;
+}
+
+void UBDC_InteractionSubsystem::OnLevelAddedToWorld(ULevel* Level, UWorld* World)
+{
+	if (Level)
 	{
-		RemovedReceivers.Empty();
-		for (UInteractionReceiverComponent* Receiver : ReceiversInField)
-		{
-			if (!NewReceiversInField.Contains(Receiver))
-			{
-				RemovedReceivers.Add(Receiver);
-				if (Receiver)
-				{
-					Receiver->OnLeavesInteractionField.Broadcast(InstigatorActor, FinalInstigatorName);
-				}
-			}
-		}
+		SetLevelInteractionActive(Level, true);
+	}
+}
+
+void UBDC_InteractionSubsystem::OnLevelRemovedFromWorld(ULevel* Level, UWorld* World)
+{
+	// A null level means the whole world is going away.
+	if (!Level)
+	{
+		PurgeWorld(World);
+		return;
 	}
 
-	ReceiversInField = NewReceiversInField;
+	// A removed level only needs its bucket while some of its receivers are still registered.
+	if (!LevelBuckets.Contains(Level)) return;
 
-	for (UInteractionInstigatorComponent* InstigatorComp : InstigatorsOfLevel)
+	SetLevelInteractionActive(Level, false);
+	if (const FInteractionLevelBucket* Bucket = LevelBuckets.Find(Level); Bucket && Bucket->Slots.Num() == 0)
 	{
-		if (InstigatorComp && InstigatorComp->bShowDebugging)
-		{
-			const FVector CurrentInstigatorLocation = InstigatorComp->GetInstigatorTransform().GetLocation();
-			FRotator CurrentInstigatorRotation = InstigatorComp->GetInstigatorTransform().Rotator();
-			CurrentInstigatorRotation.Yaw += InstigatorComp->InstigatorOffsetViewRotation;
-			
-			const FVector DebugLocation = CurrentInstigatorLocation + FVector(0, 0, 10);
+		LevelBuckets.Remove(Level);
+	}
+}
 
-			DrawDebugCircle(World, DebugLocation, Settings->InteractionRange, 36, FColor::Yellow, false, -1, 0, 2, FVector(1, 0, 0), FVector(0, 1, 0), false);
+void UBDC_InteractionSubsystem::OnWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources)
+{
+	PurgeWorld(World);
+}
 
-			const float HalfFoVInDegrees = Settings->InteractionFoV * 0.5f;
-			const FVector Forward = CurrentInstigatorRotation.Vector();
-			const FVector RightBound = Forward.RotateAngleAxis(HalfFoVInDegrees, FVector::UpVector);
-			const FVector LeftBound = Forward.RotateAngleAxis(-HalfFoVInDegrees, FVector::UpVector);
+void UBDC_InteractionSubsystem::PurgeWorld(const UWorld* World)
+{
+	if (!World) return;
 
-			DrawDebugLine(World, DebugLocation, DebugLocation + RightBound * Settings->InteractionRange, FColor::Red, false, -1, 0, 2);
-			DrawDebugLine(World, DebugLocation, DebugLocation + LeftBound * Settings->InteractionRange, FColor::Red, false, -1, 0, 2);
+	TArray<UInteractionReceiverComponent*> StaleReceivers;
+	for (auto It = LevelBuckets.CreateIterator(); It; ++It)
+	{
+		const ULevel* Level = It.Key().ResolveObjectPtr();
+		if (Level && Level->OwningWorld != World) continue;
 
-			constexpr int32 ArcSegments = 12;
-			FVector LastPoint = DebugLocation + LeftBound * Settings->InteractionRange;
-			for (int32 i = 1; i <= ArcSegments; ++i)
+		for (const int32 Slot : It.Value().Slots)
+		{
+			UInteractionReceiverComponent* ReceiverComp = ReceiverCache.Receivers[Slot];
+			if (Level || ReceiverComp->GetWorld() == World)
 			{
-				const float CurrentAngle = -HalfFoVInDegrees + (Settings->InteractionFoV * i / ArcSegments);
-				const FVector CurrentPoint = DebugLocation + Forward.RotateAngleAxis(CurrentAngle, FVector::UpVector) * Settings->InteractionRange;
-				DrawDebugLine(World, LastPoint, CurrentPoint, FColor::Red, false, -1, 0, 2);
-				LastPoint = CurrentPoint;
+				StaleReceivers.Add(ReceiverComp);
 			}
 		}
+		if (Level && !It.Value().bActive)
+		{
+			It.RemoveCurrent();
+		}
 	}
+	UnregisterReceivers(StaleReceivers);
 
-	if (AddedReceivers.Num() > 0)
+	TArray<UInteractionInstigatorComponent*> StaleInstigators;
+	for (UInteractionInstigatorComponent* InstigatorComp : InstigatorsOfLevel)
+	{
+		if (!InstigatorComp || InstigatorComp->GetWorld() == World)
+		{
+			StaleInstigators.Add(InstigatorComp);
+		}
+	}
+	for (UInteractionInstigatorComponent* InstigatorComp : StaleInstigators)
 	{
-		OnFoundReceivers.Broadcast(AddedReceivers);
+		RemoveInstigator(InstigatorComp);
 	}
 
-	if (RemovedReceivers.Num() > 0)
+	TArray<UInteractionOccluderComponent*> StaleOccluders;
+	for (const FInteractionOccluder& Occluder : Occluders)
+	{
+		if (!Occluder.Component || Occluder.Component->GetWorld() == World)
+		{
+			StaleOccluders.Add(Occluder.Component);
+		}
+	}
+	for (UInteractionOccluderComponent* OccluderComp : StaleOccluders)
 	{
-		OnLostReceivers.Broadcast(RemovedReceivers);
+		RemoveOccluder(OccluderComp);
 	}
 }
 
-void UBDC_InteractionSubsystem::GetAllReceiversField(TArray<UInteractionReceiverComponent*>& Receivers) const
+void UBDC_InteractionSubsystem::RefreshReceiverTagFilter(UInteractionReceiverComponent* ReceiverComponent)
+{
+	const int32 Slot = ReceiverCache.FindSlot(ReceiverComponent);
+	if (Slot != INDEX_NONE)
+	{
+		CompileReceiverTagFilter(Slot, ReceiverComponent);
+	}
+}
+
+void UBDC_InteractionSubsystem::RefreshInstigatorTagMask(UInteractionInstigatorComponent* InstigatorComponent)
 {
-	Receivers = ReceiversInField;
+	if (FInstigatorInteractionState* State = InstigatorStates.Find(InstigatorComponent))
+	{
+		State->TagMaskSerial = 0;
+	}
 }
 
-void UBDC_InteractionSubsystem::GetAllReceiversOfLevel(TArray<FInteractionReceivers>& Receivers) const
+void UBDC_InteractionSubsystem::RefreshReceiverShape(UInteractionReceiverComponent* ReceiverComponent)
 {
-	Receivers = ReceiversOfLevel;
+	const int32 Slot = ReceiverCache.FindSlot(ReceiverComponent);
+	if (Slot != INDEX_NONE)
+	{
+		ReceiverCache.Update(ReceiverComponent, ReceiverCache.GetLocation(Slot), ReceiverComponent->ReceiverRadius);
+		CompileReceiverShape(Slot, ReceiverComponent, ReceiverComponent->GetReceiverTransform());
+	}
 }
 
-void UBDC_InteractionSubsystem::GetReceiverByTag(FGameplayTag OfReceiverTag, FInteractionReceivers& ReceiverData) const
+void UBDC_InteractionSubsystem::CompileReceiverShape(int32 Slot, const UInteractionReceiverComponent* ReceiverComp, const FTransform& ReceiverTransform)
 {
-	for (const FInteractionReceivers& R : ReceiversOfLevel)
+	EInteractionReceiverFlags ShapeFlags = EInteractionReceiverFlags::None;
+	FBox Bounds(ForceInit);
+
+	switch (ReceiverComp->InteractionShape)
+	{
+	case EInteractionReceiverShape::Capsule:
+		ShapeFlags |= EInteractionReceiverFlags::ShapeCapsule;
+		Bounds = FBox::BuildAABB(ReceiverTransform.GetLocation(), FVector(ReceiverComp->ReceiverRadius, ReceiverComp->ReceiverRadius, FMath::Max(ReceiverComp->CapsuleHalfHeight, ReceiverComp->ReceiverRadius)));
+		break;
+	case EInteractionReceiverShape::Box:
+		ShapeFlags |= EInteractionReceiverFlags::ShapeBox;
+		Bounds = FBox(-ReceiverComp->BoxExtent, ReceiverComp->BoxExtent).TransformBy(ReceiverTransform);
+		break;
+	default:
+		break;
+	}
+
+	if (ReceiverComp->MaxVerticalDistance > 0.0f)
+	{
+		ShapeFlags |= EInteractionReceiverFlags::VerticalLimit;
+	}
+
+	const float RangeOverride = FMath::Max(0.0f, ReceiverComp->InteractionRangeOverride);
+	ReceiverCache.SetShape(Slot, ShapeFlags, Bounds, ReceiverTransform, ReceiverComp->BoxExtent, RangeOverride, ReceiverComp->MaxVerticalDistance, ReceiverComp->InteractionPriority);
+
+	// The 2D kernel has to reach the box's farthest corner on the ground plane. Opposite corners mirror each other, so four are enough.
+	if (EnumHasAnyFlags(ShapeFlags, EInteractionReceiverFlags::ShapeBox))
 	{
-		if (const UInteractionReceiverComponent* Comp = Cast<UInteractionReceiverComponent>(R.InteractionComponent))
+		const FVector& Extent = ReceiverComp->BoxExtent;
+		float BroadRadius = 0.0f;
+		for (int32 Corner = 0; Corner < 4; ++Corner)
 		{
-			if (Comp->TagOfReceiver == OfReceiverTag)
-			{
-				ReceiverData = R;
-				return;
-			}
+			const FVector Offset = ReceiverTransform.TransformVector(FVector((Corner & 1) ? Extent.X : -Extent.X, (Corner & 2) ? Extent.Y : -Extent.Y, Extent.Z));
+			BroadRadius = FMath::Max(BroadRadius, static_cast<float>(FVector2D(Offset.X, Offset.Y).Size()));
 		}
+		ReceiverCache.Radius[Slot] = BroadRadius;
 	}
-	ReceiverData = FInteractionReceivers();
+
+	ClassifyReceiverReach(Slot);
 }
 
-void UBDC_InteractionSubsystem::GetReceiverByName(FName OfReceiverName, FInteractionReceivers& ReceiverData) const
+void UBDC_InteractionSubsystem::CompileReceiverTagFilter(int32 Slot, const UInteractionReceiverComponent* ReceiverComp)
 {
-	for (const FInteractionReceivers& R : ReceiversOfLevel)
+	uint64 Mask = 0;
+	EInteractionReceiverFlags FilterFlags = EInteractionReceiverFlags::None;
+
+	if (!ReceiverComp->OnlyInteractOnTag.IsEmpty())
 	{
-		if (UInteractionReceiverComponent* Comp = Cast<UInteractionReceiverComponent>(R.InteractionComponent))
+		FilterFlags |= EInteractionReceiverFlags::TagFiltered;
+		if (ReceiverComp->bAllTagsHaveToBePresent)
 		{
-			if (Comp->NameOfReceiver == OfReceiverName)
+			FilterFlags |= EInteractionReceiverFlags::RequiresAllTags;
+		}
+
+		for (const FGameplayTag& Tag : ReceiverComp->OnlyInteractOnTag)
+		{
+			const int32* Bit = TagFilterBits.Find(Tag);
+			if (!Bit && TagFilterBits.Num() < 64)
+			{
+				Bit = &TagFilterBits.Add(Tag, TagFilterBits.Num());
+				++TagFilterSerial;
+			}
+
+			if (Bit)
+			{
+				Mask |= uint64(1) << *Bit;
+			}
+			else
 			{
-				ReceiverData = R;
-				return;
+				FilterFlags |= EInteractionReceiverFlags::TagFilterOverflow;
 			}
 		}
 	}
-	ReceiverData = FInteractionReceivers();
+
+	ReceiverCache.SetTagFilter(Slot, Mask, FilterFlags);
 }
 
-void UBDC_InteractionSubsystem::GetInstigatorByTag(FGameplayTag OfInstigatorTag, FInteractionReceivers& InstigatorData) const
+uint64 UBDC_InteractionSubsystem::CompileInstigatorTagMask(const UInteractionInstigatorComponent* InstigatorComp) const
 {
-	for (const UInteractionInstigatorComponent* I : InstigatorsOfLevel)
+	uint64 Mask = 0;
+	if (!InstigatorComp || TagFilterBits.Num() == 0) return Mask;
+
+	// Parents are folded in so "Key.Gold" satisfies a receiver asking for "Key", like FGameplayTagContainer::HasAny.
+	for (const FGameplayTag& Tag : InstigatorComp->InstigatingTags)
 	{
-		if (I && I->TagOfInstigator == OfInstigatorTag)
+		for (const FGameplayTag& ParentTag : Tag.GetGameplayTagParents())
 		{
-			InstigatorData.InteractionActor = I->GetOwner();
-			InstigatorData.InteractionComponent = const_cast<UInteractionInstigatorComponent*>(I);
-			return;
+			if (const int32* Bit = TagFilterBits.Find(ParentTag))
+			{
+				Mask |= uint64(1) << *Bit;
+			}
 		}
 	}
-	InstigatorData = FInteractionReceivers();
+	return Mask;
 }
 
-void UBDC_InteractionSubsystem::GetInstigatorByName(FName OfInstigatorName, FInteractionReceivers& InstigatorData) const
+uint64 UBDC_InteractionSubsystem::GetInstigatorTagMask(FInstigatorInteractionState& State) const
 {
-	for (UInteractionInstigatorComponent* I : InstigatorsOfLevel)
+	if (State.TagMaskSerial != TagFilterSerial)
 	{
-		if (I && I->NameOfInstigator == OfInstigatorName)
+		State.InstigatorTagMask = CompileInstigatorTagMask(State.Instigator);
+		State.TagMaskSerial = TagFilterSerial;
+	}
+	return State.InstigatorTagMask;
+}
+
+TConstArrayView<const FInteractionOccluder*> UBDC_InteractionSubsystem::GetNearbyOccluders(const UBDC_InteractionSettings* Settings, FInstigatorInteractionState& State, const FVector& InstigatorLocation) const
+{
+	if (!Settings->bUseCoarseOcclusion || Occluders.Num() == 0) return {};
+
+	// Gathered with some slack, so an instigator moving through a time-sliced sweep keeps its list for many steps.
+	const float Radius = GetBroadPhaseRadius(Settings->InteractionRange);
+	if (State.SweepOccluderSerial != OccluderSerial || FVector::Dist(State.SweepOccluderCenter, InstigatorLocation) + Radius > State.SweepOccluderRadius)
+	{
+		State.SweepOccluders.Reset();
+		State.SweepOccluderCenter = InstigatorLocation;
+		State.SweepOccluderRadius = Radius * 1.25f;
+		State.SweepOccluderSerial = OccluderSerial;
+
+		const FBox QueryBounds = FBox::BuildAABB(InstigatorLocation, FVector(State.SweepOccluderRadius));
+		for (const FInteractionOccluder& Occluder : Occluders)
 		{
-			InstigatorData.InteractionActor = I->GetOwner();
-			InstigatorData.InteractionComponent = I;
-			return;
+			if (Occluder.Bounds.Intersect(QueryBounds))
+			{
+				State.SweepOccluders.Add(&Occluder);
+			}
 		}
 	}
-	InstigatorData = FInteractionReceivers();
+	return State.SweepOccluders;
 }
 
-void UBDC_InteractionSubsystem::AddReceiver(FInteractionReceivers NewReceiver)
+bool UBDC_InteractionSubsystem::PassesTagFilter(int32 Slot, uint64 InstigatorTagMask, const UInteractionInstigatorComponent* InstigatorComp) const
+{
+	const EInteractionReceiverFlags SlotFlags = ReceiverCache.Flags[Slot];
+	if (!EnumHasAnyFlags(SlotFlags, EInteractionReceiverFlags::TagFiltered)) return true;
+
+	const bool bRequiresAll = EnumHasAnyFlags(SlotFlags, EInteractionReceiverFlags::RequiresAllTags);
+
+	if (EnumHasAnyFlags(SlotFlags, EInteractionReceiverFlags::TagFilterOverflow))
+	{
+		const FGameplayTagContainer& RequiredTags = ReceiverCache.Receivers[Slot]->OnlyInteractOnTag;
+		return bRequiresAll ? InstigatorComp->InstigatingTags.HasAll(RequiredTags) : InstigatorComp->InstigatingTags.HasAny(RequiredTags);
+	}
+
+	const uint64 RequiredMask = ReceiverCache.RequiredTagMask[Slot];
+	return bRequiresAll ? (InstigatorTagMask & RequiredMask) == RequiredMask : (InstigatorTagMask & RequiredMask) != 0;
+}
+
+void UBDC_InteractionSubsystem::AddOccluder(UInteractionOccluderComponent* OccluderComponent)
 {
-	ReceiversOfLevel.AddUnique(NewReceiver);
+	if (!OccluderComponent) return;
+
+	const int32* ExistingIndex = OccluderIndices.Find(OccluderComponent);
+	FInteractionOccluder& Occluder = ExistingIndex ? Occluders[*ExistingIndex] : Occluders.AddDefaulted_GetRef();
+	if (!ExistingIndex)
+	{
+		OccluderIndices.Add(OccluderComponent, Occluders.Num() - 1);
+	}
+
+	Occluder.Component = OccluderComponent;
+	Occluder.Owner = OccluderComponent->GetOwner();
+	Occluder.Bounds = OccluderComponent->GetOccluderBounds();
+	Occluder.Transform = OccluderComponent->GetComponentTransform();
+	Occluder.Extent = OccluderComponent->BoxExtent;
+	++OccluderSerial;
 }
 
-void UBDC_InteractionSubsystem::RemoveReceiver(UInteractionReceiverComponent* ReceiverComponent)
+void UBDC_InteractionSubsystem::RemoveOccluder(UInteractionOccluderComponent* OccluderComponent)
 {
-	ReceiversOfLevel.RemoveAll([ReceiverComponent](const FInteractionReceivers& R) {
-		return R.InteractionComponent == ReceiverComponent;
-	});
-	ReceiversInField.Remove(ReceiverComponent);
-	ReceiversInView.Remove(ReceiverComponent);
+	int32 Index;
+	if (!OccluderIndices.RemoveAndCopyValue(OccluderComponent, Index)) return;
+
+	Occluders.RemoveAtSwap(Index);
+	if (Occluders.IsValidIndex(Index))
+	{
+		OccluderIndices[Occluders[Index].Component] = Index;
+	}
+	++OccluderSerial;
+}
+
+FInteractionReceiverHandle UBDC_InteractionSubsystem::GetReceiverHandle(UInteractionReceiverComponent* ReceiverComponent) const
+{
+	return ReceiverCache.GetHandle(ReceiverCache.FindSlot(ReceiverComponent));
+}
+
+UInteractionReceiverComponent* UBDC_InteractionSubsystem::ResolveReceiverHandle(const FInteractionReceiverHandle& Handle) const
+{
+	return ReceiverCache.Resolve(Handle);
+}
+
+void UBDC_InteractionSubsystem::UpdateReceiverLocation(UInteractionReceiverComponent* ReceiverComponent)
+{
+	const int32 Slot = ReceiverCache.FindSlot(ReceiverComponent);
+	if (Slot == INDEX_NONE) return;
+
+	const FTransform ReceiverTransform = ReceiverComponent->GetReceiverTransform();
+	const FVector ReceiverLocation = ReceiverTransform.GetLocation();
+	if (!ReceiverCache.HasAnyFlags(Slot, EInteractionReceiverFlags::OutOfGridMask))
+	{
+		ReceiverGrid.Move(Slot, ReceiverLocation);
+	}
+	ReceiverCache.Update(ReceiverComponent, ReceiverLocation, ReceiverComponent->ReceiverRadius);
+	CompileReceiverShape(Slot, ReceiverComponent, ReceiverTransform);
+
+	const FInteractionReceiverHandle Handle = GetReceiverHandle(ReceiverComponent);
+	for (TPair<UInteractionInstigatorComponent*, FInstigatorInteractionState>& Pair : InstigatorStates)
+	{
+		Pair.Value.LineOfSightCache.Remove(Handle);
+	}
 }
 
 void UBDC_InteractionSubsystem::AddInstigator(UInteractionInstigatorComponent* NewInstigator)
 {
 	InstigatorsOfLevel.AddUnique(NewInstigator);
+
+	if (NewInstigator)
+	{
+		InstigatorLookup.Add(NewInstigator, NewInstigator->NameOfInstigator, NewInstigator->TagOfInstigator);
+	}
 }
 
 void UBDC_InteractionSubsystem::RemoveInstigator(UInteractionInstigatorComponent* InstigatorComponent)
 {
 	InstigatorsOfLevel.Remove(InstigatorComponent);
+	InstigatorLookup.Remove(InstigatorComponent);
+	InstigatorStates.Remove(InstigatorComponent);
+	QueuedBestFitChanges.Remove(InstigatorComponent);
+	for (auto It = QueuedFieldChanges.CreateIterator(); It; ++It)
+	{
+		if (It.Key().Key == InstigatorComponent)
+		{
+			It.RemoveCurrent();
+		}
+	}
 	if (Instigator == InstigatorComponent)
 	{
 		Instigator = nullptr;
@@ -328,58 +2098,100 @@ void UBDC_InteractionSubsystem::RemoveInstigator(UInteractionInstigatorComponent
 
 void UBDC_InteractionSubsystem::GetAllReceiversInView(TArray<FInteractionReceivers>& OutReceiversInView) const
 {
-	OutReceiversInView.Empty();
-	for (UInteractionReceiverComponent* Comp : ReceiversInView)
+	GetAllReceiversInViewOf(Instigator, OutReceiversInView);
+}
+
+void UBDC_InteractionSubsystem::GetAllReceiversInViewOf(UInteractionInstigatorComponent* ForInstigator, TArray<FInteractionReceivers>& OutReceiversInView) const
+{
+	OutReceiversInView = GetViewReceiversView(ForInstigator);
+}
+
+TConstArrayView<UInteractionReceiverComponent*> UBDC_InteractionSubsystem::GetReceiversInFieldView(UInteractionInstigatorComponent* ForInstigator) const
+{
+	const FInstigatorInteractionState* State = FindState(ForInstigator);
+	return State ? TConstArrayView<UInteractionReceiverComponent*>(State->ReceiversInField) : TConstArrayView<UInteractionReceiverComponent*>();
+}
+
+TConstArrayView<UInteractionReceiverComponent*> UBDC_InteractionSubsystem::GetReceiversInViewView(UInteractionInstigatorComponent* ForInstigator) const
+{
+	const FInstigatorInteractionState* State = FindState(ForInstigator);
+	return State ? TConstArrayView<UInteractionReceiverComponent*>(State->ReceiversInView) : TConstArrayView<UInteractionReceiverComponent*>();
+}
+
+TConstArrayView<FInteractionReceivers> UBDC_InteractionSubsystem::GetViewReceiversView(UInteractionInstigatorComponent* ForInstigator) const
+{
+	const FInstigatorInteractionState* State = FindState(ForInstigator);
+	return State ? TConstArrayView<FInteractionReceivers>(State->ViewReceivers) : TConstArrayView<FInteractionReceivers>();
+}
+
+void UBDC_InteractionSubsystem::ForEachReceiverOfLevel(TFunctionRef<void(const FInteractionReceivers&)> Visitor) const
+{
+	for (const FInteractionReceivers& Entry : ReceiversOfLevel)
 	{
-		if (Comp)
+		if (Entry.InteractionComponent)
 		{
-			FInteractionReceivers Data;
-			Data.InteractionActor = Comp->GetOwner();
-			Data.InteractionComponent = Comp;
-			OutReceiversInView.Add(Data);
+			Visitor(Entry);
 		}
 	}
 }
 
 void UBDC_InteractionSubsystem::CalcNextBest()
 {
-	if (ReceiversInView.Num() <= 1) return;
-
-	if (const UInteractionReceiverComponent* OldBestReceiver = Cast<UInteractionReceiverComponent>(CurrentBestFittingReceiver.InteractionComponent))
-	{
-		OldBestReceiver->OnIsNotBestFitting.Broadcast();
-	}
+	CalcNextBestFor(Instigator);
+}
 
-	CurrentBestReceiverIndex = (CurrentBestReceiverIndex + 1) % ReceiversInView.Num();
+void UBDC_InteractionSubsystem::CalcPrevBest()
+{
+	CalcPrevBestFor(Instigator);
+}
 
-	if (UInteractionReceiverComponent* NewBestReceiver = ReceiversInView[CurrentBestReceiverIndex])
+void UBDC_InteractionSubsystem::CalcNextBestFor(UInteractionInstigatorComponent* ForInstigator)
+{
+	if (FInstigatorInteractionState* State = InstigatorStates.Find(ForInstigator))
 	{
-		NewBestReceiver->OnIsBestFitting.Broadcast();
-		CurrentBestFittingReceiver.InteractionComponent = NewBestReceiver;
-		CurrentBestFittingReceiver.InteractionActor = NewBestReceiver->GetOwner();
+		CycleBest(*State, 1);
 	}
 }
 
-void UBDC_InteractionSubsystem::CalcPrevBest()
+void UBDC_InteractionSubsystem::CalcPrevBestFor(UInteractionInstigatorComponent* ForInstigator)
 {
-	if (ReceiversInView.Num() <= 1) return;
-
-	if (const UInteractionReceiverComponent* OldBestReceiver = Cast<UInteractionReceiverComponent>(CurrentBestFittingReceiver.InteractionComponent))
+	if (FInstigatorInteractionState* State = InstigatorStates.Find(ForInstigator))
 	{
-		OldBestReceiver->OnIsNotBestFitting.Broadcast();
+		CycleBest(*State, -1);
 	}
+}
+
+void UBDC_InteractionSubsystem::CycleBest(FInstigatorInteractionState& State, int32 Direction)
+{
+	const int32 NumInView = State.ReceiversInView.Num();
+	if (NumInView <= 1) return;
 
-	CurrentBestReceiverIndex = (CurrentBestReceiverIndex - 1 + ReceiversInView.Num()) % ReceiversInView.Num();
+	UInteractionReceiverComponent* OldBestReceiver = Cast<UInteractionReceiverComponent>(State.CurrentBestFittingReceiver.InteractionComponent);
+	State.CurrentBestReceiverIndex = (State.CurrentBestReceiverIndex + Direction + NumInView) % NumInView;
+	State.bBestHeldByHysteresis = false;
 
-	if (UInteractionReceiverComponent* NewBestReceiver = ReceiversInView[CurrentBestReceiverIndex])
+	if (UInteractionReceiverComponent* NewBestReceiver = State.ReceiversInView[State.CurrentBestReceiverIndex])
 	{
-		NewBestReceiver->OnIsBestFitting.Broadcast();
-		CurrentBestFittingReceiver.InteractionComponent = NewBestReceiver;
-		CurrentBestFittingReceiver.InteractionActor = NewBestReceiver->GetOwner();
+		QueueBestFitChange(State.Instigator, OldBestReceiver, NewBestReceiver);
+		State.CurrentBestFittingReceiver.InteractionComponent = NewBestReceiver;
+		State.CurrentBestFittingReceiver.InteractionActor = NewBestReceiver->GetOwner();
+
+		if (State.Instigator && NewBestReceiver != OldBestReceiver)
+		{
+			State.Instigator->ReplicateInteractionState({}, {}, NewBestReceiver);
+		}
 	}
+
+	DispatchQueuedEventsUnlessBatched();
 }
 
 void UBDC_InteractionSubsystem::GetCurrentBestFitting(FInteractionReceivers& BestFit) const
 {
-	BestFit = CurrentBestFittingReceiver;
-}
\ No newline at end of file
+	GetCurrentBestFittingOf(Instigator, BestFit);
+}
+
+void UBDC_InteractionSubsystem::GetCurrentBestFittingOf(UInteractionInstigatorComponent* ForInstigator, FInteractionReceivers& BestFit) const
+{
+	const FInstigatorInteractionState* State = FindState(ForInstigator);
+	BestFit = State ? State->CurrentBestFittingReceiver : FInteractionReceivers();
+}
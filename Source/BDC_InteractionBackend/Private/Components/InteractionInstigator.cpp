@@ -10,12 +10,134 @@
 #include "BDC_InteractionSubsystem.h"
 #include "Engine/World.h"
 #include "Engine/GameInstance.h"
+#include "Net/UnrealNetwork.h"
+
+void FInteractionReplicatedReceiver::PostReplicatedAdd(const FInteractionReplicatedReceiverArray& InArraySerializer)
+{
+	if (InArraySerializer.Owner)
+	{
+		InArraySerializer.Owner->OnReplicatedInteractionStateChanged.Broadcast();
+	}
+}
+
+void FInteractionReplicatedReceiver::PreReplicatedRemove(const FInteractionReplicatedReceiverArray& InArraySerializer)
+{
+	if (InArraySerializer.Owner)
+	{
+		InArraySerializer.Owner->OnReplicatedInteractionStateChanged.Broadcast();
+	}
+}
+
+void FInteractionReplicatedReceiverArray::Add(UInteractionReceiverComponent* Receiver)
+{
+	if (!Receiver || ItemIndices.Contains(Receiver)) return;
+
+	ItemIndices.Add(Receiver, Items.Num());
+	FInteractionReplicatedReceiver& Item = Items.AddDefaulted_GetRef();
+	Item.Receiver = Receiver;
+	MarkItemDirty(Item);
+}
+
+bool FInteractionReplicatedReceiverArray::Remove(const UInteractionReceiverComponent* Receiver)
+{
+	int32 Index;
+	if (!ItemIndices.RemoveAndCopyValue(Receiver, Index)) return false;
+
+	Items.RemoveAtSwap(Index, 1, false);
+	if (Items.IsValidIndex(Index))
+	{
+		ItemIndices.Add(Items[Index].Receiver, Index);
+	}
+	MarkArrayDirty();
+	return true;
+}
 
 UInteractionInstigatorComponent::UInteractionInstigatorComponent()
 {
 	PrimaryComponentTick.bCanEverTick = false;
 	bAutoActivate = true;
 	SetIsReplicatedByDefault(true);
+	ReplicatedReceiversInField.Owner = this;
+}
+
+void UInteractionInstigatorComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	// Only the owning player acts on its own interaction state; simulated proxies would just burn bandwidth.
+	DOREPLIFETIME_CONDITION(UInteractionInstigatorComponent, ReplicatedReceiversInField, COND_OwnerOnly);
+	DOREPLIFETIME_CONDITION(UInteractionInstigatorComponent, ReplicatedBestFittingReceiver, COND_OwnerOnly);
+}
+
+void UInteractionInstigatorComponent::GetReplicatedReceiversInField(TArray<UInteractionReceiverComponent*>& Receivers) const
+{
+	Receivers.Reset(ReplicatedReceiversInField.Items.Num());
+	for (const FInteractionReplicatedReceiver& Item : ReplicatedReceiversInField.Items)
+	{
+		if (Item.Receiver)
+		{
+			Receivers.Add(Item.Receiver);
+		}
+	}
+}
+
+void UInteractionInstigatorComponent::ReplicateInteractionState(TConstArrayView<UInteractionReceiverComponent*> AddedReceivers, TConstArrayView<UInteractionReceiverComponent*> RemovedReceivers, UInteractionReceiverComponent* BestReceiver)
+{
+	if (!GetIsReplicated() || GetNetMode() == NM_Standalone || !GetOwner() || !GetOwner()->HasAuthority()) return;
+
+	for (UInteractionReceiverComponent* Receiver : RemovedReceivers)
+	{
+		ReplicatedReceiversInField.Remove(Receiver);
+	}
+	for (UInteractionReceiverComponent* Receiver : AddedReceivers)
+	{
+		ReplicatedReceiversInField.Add(Receiver);
+	}
+	ReplicatedBestFittingReceiver = BestReceiver;
+}
+
+void UInteractionInstigatorComponent::OnRep_ReplicatedBestFittingReceiver()
+{
+	OnReplicatedInteractionStateChanged.Broadcast();
+}
+
+void UInteractionInstigatorComponent::RequestInteraction()
+{
+	const UWorld* World = GetWorld();
+	const UGameInstance* GI = World ? World->GetGameInstance() : nullptr;
+	UBDC_InteractionSubsystem* Subsystem = GI ? GI->GetSubsystem<UBDC_InteractionSubsystem>() : nullptr;
+
+	if (GetOwner() && GetOwner()->HasAuthority())
+	{
+		if (Subsystem)
+		{
+			Subsystem->InjectValidatedInteractionFor(this, nullptr);
+		}
+		return;
+	}
+
+	// The local prediction picks the receiver; the server decides whether it is actually reachable.
+	FInteractionReceivers BestFit;
+	if (Subsystem)
+	{
+		Subsystem->GetCurrentBestFittingOf(this, BestFit);
+	}
+	UInteractionReceiverComponent* ExpectedReceiver = Cast<UInteractionReceiverComponent>(BestFit.InteractionComponent);
+	ServerRequestInteraction(ExpectedReceiver ? ExpectedReceiver : ReplicatedBestFittingReceiver);
+}
+
+void UInteractionInstigatorComponent::ServerRequestInteraction_Implementation(UInteractionReceiverComponent* ExpectedReceiver)
+{
+	if (const UWorld* World = GetWorld())
+	{
+		if (const UGameInstance* GI = World->GetGameInstance())
+		{
+			if (UBDC_InteractionSubsystem* Subsystem = GI->GetSubsystem<UBDC_InteractionSubsystem>())
+			{
+				Subsystem->InjectValidatedInteractionFor(this, ExpectedReceiver);
+			}
+		}
+	}
 }
 
 FTransform UInteractionInstigatorComponent::GetInstigatorTransform() const
@@ -33,6 +155,47 @@ FTransform UInteractionInstigatorComponent::GetInstigatorTransform() const
 	return FTransform::Identity;
 }
 
+void UInteractionInstigatorComponent::SetNameOfInstigator(FName NewName)
+{
+	NameOfInstigator = NewName;
+	RefreshSubsystemLookup();
+}
+
+void UInteractionInstigatorComponent::SetTagOfInstigator(FGameplayTag NewTag)
+{
+	TagOfInstigator = NewTag;
+	RefreshSubsystemLookup();
+}
+
+void UInteractionInstigatorComponent::SetInstigatingTags(FGameplayTagContainer NewInstigatingTags)
+{
+	InstigatingTags = NewInstigatingTags;
+	if (const UWorld* World = GetWorld())
+	{
+		if (const UGameInstance* GI = World->GetGameInstance())
+		{
+			if (UBDC_InteractionSubsystem* Subsystem = GI->GetSubsystem<UBDC_InteractionSubsystem>())
+			{
+				Subsystem->RefreshInstigatorTagMask(this);
+			}
+		}
+	}
+}
+
+void UInteractionInstigatorComponent::RefreshSubsystemLookup()
+{
+	if (const UWorld* World = GetWorld())
+	{
+		if (const UGameInstance* GI = World->GetGameInstance())
+		{
+			if (UBDC_InteractionSubsystem* Subsystem = GI->GetSubsystem<UBDC_InteractionSubsystem>())
+			{
+				Subsystem->RefreshInstigatorLookup(this);
+			}
+		}
+	}
+}
+
 void UInteractionInstigatorComponent::BeginPlay()
 {
 	Super::BeginPlay();
@@ -0,0 +1,90 @@
+/* Copyright © beginning at 2026 - BlackDevilCreations
+ * Author: Patrick Wenzel
+ * All rights reserved.
+ * This file is part of a BlackDevilCreations project and may not be distributed, copied,
+ * or modified without prior written permission from BlackDevilCreations.
+ * Unreal Engine and its associated trademarks are property of Epic Games, Inc.
+ * and are used with permission.
+ */
+#include "Components/InteractionOccluder.h"
+#include "BDC_InteractionSubsystem.h"
+#include "Engine/World.h"
+#include "Engine/GameInstance.h"
+
+UInteractionOccluderComponent::UInteractionOccluderComponent()
+{
+	PrimaryComponentTick.bCanEverTick = false;
+}
+
+FBox UInteractionOccluderComponent::GetOccluderBounds() const
+{
+	return FBox(-BoxExtent, BoxExtent).TransformBy(GetComponentTransform());
+}
+
+void UInteractionOccluderComponent::SetBoxExtent(FVector NewBoxExtent)
+{
+	BoxExtent = NewBoxExtent;
+
+	if (!HasBegunPlay()) return;
+
+	if (const UWorld* World = GetWorld())
+	{
+		if (const UGameInstance* GI = World->GetGameInstance())
+		{
+			if (UBDC_InteractionSubsystem* Subsystem = GI->GetSubsystem<UBDC_InteractionSubsystem>())
+			{
+				Subsystem->AddOccluder(this);
+			}
+		}
+	}
+}
+
+void UInteractionOccluderComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	if (const UWorld* World = GetWorld())
+	{
+		if (const UGameInstance* GI = World->GetGameInstance())
+		{
+			if (UBDC_InteractionSubsystem* Subsystem = GI->GetSubsystem<UBDC_InteractionSubsystem>())
+			{
+				Subsystem->AddOccluder(this);
+			}
+		}
+	}
+}
+
+void UInteractionOccluderComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (const UWorld* World = GetWorld())
+	{
+		if (const UGameInstance* GI = World->GetGameInstance())
+		{
+			if (UBDC_InteractionSubsystem* Subsystem = GI->GetSubsystem<UBDC_InteractionSubsystem>())
+			{
+				Subsystem->RemoveOccluder(this);
+			}
+		}
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void UInteractionOccluderComponent::OnUpdateTransform(EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport)
+{
+	Super::OnUpdateTransform(UpdateTransformFlags, Teleport);
+
+	if (!HasBegunPlay()) return;
+
+	if (const UWorld* World = GetWorld())
+	{
+		if (const UGameInstance* GI = World->GetGameInstance())
+		{
+			if (UBDC_InteractionSubsystem* Subsystem = GI->GetSubsystem<UBDC_InteractionSubsystem>())
+			{
+				Subsystem->AddOccluder(this);
+			}
+		}
+	}
+}
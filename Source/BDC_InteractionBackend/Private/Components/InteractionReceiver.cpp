@@ -34,6 +34,129 @@ FTransform UInteractionReceiverComponent::GetReceiverTransform() const
 	return FTransform::Identity;
 }
 
+void UInteractionReceiverComponent::SetNameOfReceiver(FName NewName)
+{
+	NameOfReceiver = NewName;
+	if (UBDC_InteractionSubsystem* Subsystem = OwningSubsystem.Get())
+	{
+		Subsystem->RefreshReceiverLookup(this);
+	}
+}
+
+void UInteractionReceiverComponent::SetTagOfReceiver(FGameplayTag NewTag)
+{
+	TagOfReceiver = NewTag;
+	if (UBDC_InteractionSubsystem* Subsystem = OwningSubsystem.Get())
+	{
+		Subsystem->RefreshReceiverLookup(this);
+	}
+}
+
+void UInteractionReceiverComponent::SetInteractionTagFilter(FGameplayTagContainer NewOnlyInteractOnTag, bool bNewAllTagsHaveToBePresent)
+{
+	OnlyInteractOnTag = NewOnlyInteractOnTag;
+	bAllTagsHaveToBePresent = bNewAllTagsHaveToBePresent;
+	if (UBDC_InteractionSubsystem* Subsystem = OwningSubsystem.Get())
+	{
+		Subsystem->RefreshReceiverTagFilter(this);
+	}
+}
+
+void UInteractionReceiverComponent::SetOnlyInteractOnTag(FGameplayTagContainer NewOnlyInteractOnTag)
+{
+	SetInteractionTagFilter(NewOnlyInteractOnTag, bAllTagsHaveToBePresent);
+}
+
+void UInteractionReceiverComponent::SetAllTagsHaveToBePresent(bool bNewAllTagsHaveToBePresent)
+{
+	SetInteractionTagFilter(OnlyInteractOnTag, bNewAllTagsHaveToBePresent);
+}
+
+void UInteractionReceiverComponent::SetInteractionPriority(float NewPriority)
+{
+	InteractionPriority = NewPriority;
+	if (UBDC_InteractionSubsystem* Subsystem = OwningSubsystem.Get())
+	{
+		Subsystem->RefreshReceiverShape(this);
+	}
+}
+
+void UInteractionReceiverComponent::SetInteractionRangeOverride(float NewRangeOverride)
+{
+	InteractionRangeOverride = NewRangeOverride;
+	if (UBDC_InteractionSubsystem* Subsystem = OwningSubsystem.Get())
+	{
+		Subsystem->RefreshReceiverShape(this);
+	}
+}
+
+void UInteractionReceiverComponent::SetInteractionShape(EInteractionReceiverShape NewShape, float NewCapsuleHalfHeight, FVector NewBoxExtent, float NewMaxVerticalDistance)
+{
+	InteractionShape = NewShape;
+	CapsuleHalfHeight = NewCapsuleHalfHeight;
+	BoxExtent = NewBoxExtent;
+	MaxVerticalDistance = NewMaxVerticalDistance;
+	if (UBDC_InteractionSubsystem* Subsystem = OwningSubsystem.Get())
+	{
+		Subsystem->RefreshReceiverShape(this);
+	}
+}
+
+void UInteractionReceiverComponent::SetInteractionShapeType(EInteractionReceiverShape NewShape)
+{
+	SetInteractionShape(NewShape, CapsuleHalfHeight, BoxExtent, MaxVerticalDistance);
+}
+
+void UInteractionReceiverComponent::SetCapsuleHalfHeight(float NewCapsuleHalfHeight)
+{
+	SetInteractionShape(InteractionShape, NewCapsuleHalfHeight, BoxExtent, MaxVerticalDistance);
+}
+
+void UInteractionReceiverComponent::SetBoxExtent(FVector NewBoxExtent)
+{
+	SetInteractionShape(InteractionShape, CapsuleHalfHeight, NewBoxExtent, MaxVerticalDistance);
+}
+
+void UInteractionReceiverComponent::SetMaxVerticalDistance(float NewMaxVerticalDistance)
+{
+	SetInteractionShape(InteractionShape, CapsuleHalfHeight, BoxExtent, NewMaxVerticalDistance);
+}
+
+void UInteractionReceiverComponent::SetReceiverRadius(float NewReceiverRadius)
+{
+	ReceiverRadius = NewReceiverRadius;
+	if (UBDC_InteractionSubsystem* Subsystem = OwningSubsystem.Get())
+	{
+		Subsystem->RefreshReceiverShape(this);
+	}
+}
+
+void UInteractionReceiverComponent::SetInteractionDormant(float AutoWakeAfterSeconds)
+{
+	bInteractionDormant = true;
+	if (UBDC_InteractionSubsystem* Subsystem = OwningSubsystem.Get())
+	{
+		Subsystem->SetReceiverDormant(this, true, AutoWakeAfterSeconds);
+	}
+}
+
+void UInteractionReceiverComponent::WakeInteraction()
+{
+	bInteractionDormant = false;
+	if (UBDC_InteractionSubsystem* Subsystem = OwningSubsystem.Get())
+	{
+		Subsystem->SetReceiverDormant(this, false);
+	}
+}
+
+void UInteractionReceiverComponent::OnTrackedTransformUpdated(USceneComponent* UpdatedComponent, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport)
+{
+	if (UBDC_InteractionSubsystem* Subsystem = OwningSubsystem.Get())
+	{
+		Subsystem->UpdateReceiverLocation(this);
+	}
+}
+
 void UInteractionReceiverComponent::BeginPlay()
 {
 	Super::BeginPlay();
@@ -53,6 +176,8 @@ void UInteractionReceiverComponent::BeginPlay()
 		}
 	}
 
+	bInteractionDormant = bStartDormant;
+
 	if (const UWorld* World = GetWorld())
 	{
 		if (const UGameInstance* GI = World->GetGameInstance())
@@ -63,13 +188,28 @@ void UInteractionReceiverComponent::BeginPlay()
 				NewReceiver.InteractionActor = GetOwner();
 				NewReceiver.InteractionComponent = this;
 				Subsystem->AddReceiver(NewReceiver);
+				OwningSubsystem = Subsystem;
 			}
 		}
 	}
+
+	if (USceneComponent* Tracked = ReceiverComponent ? ReceiverComponent : (GetOwner() ? GetOwner()->GetRootComponent() : nullptr))
+	{
+		TrackedComponent = Tracked;
+		TransformUpdatedHandle = Tracked->TransformUpdated.AddUObject(this, &UInteractionReceiverComponent::OnTrackedTransformUpdated);
+	}
 }
 
 void UInteractionReceiverComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
+	if (USceneComponent* Tracked = TrackedComponent.Get())
+	{
+		Tracked->TransformUpdated.Remove(TransformUpdatedHandle);
+	}
+	TrackedComponent.Reset();
+	TransformUpdatedHandle.Reset();
+	OwningSubsystem.Reset();
+
 	if (const UWorld* World = GetWorld())
 	{
 		if (const UGameInstance* GI = World->GetGameInstance())
@@ -0,0 +1,38 @@
+/* Copyright © beginning at 2026 - BlackDevilCreations
+ * Author: Patrick Wenzel
+ * All rights reserved.
+ * This file is part of a BlackDevilCreations project and may not be distributed, copied,
+ * or modified without prior written permission from BlackDevilCreations.
+ * Unreal Engine and its associated trademarks are property of Epic Games, Inc.
+ * and are used with permission.
+ */
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if !UE_BUILD_SHIPPING
+
+/** Timings of one operation in an interaction benchmark run. */
+struct BDC_INTERACTIONBACKEND_API FInteractionBenchmarkResult
+{
+	FString Operation;
+	int32 Receivers = 0;
+	TArray<double> SampleMicroseconds;
+
+	double GetTotalMicroseconds() const;
+	double GetAverageMicroseconds() const;
+	double GetMinMicroseconds() const;
+	double GetMaxMicroseconds() const;
+};
+
+/** CSV output shared by the BDC.Interaction.Benchmark command and the performance tests, so their results can be compared directly. */
+struct BDC_INTERACTIONBACKEND_API FInteractionBenchmarkReport
+{
+	static FString ToCsv(TConstArrayView<FInteractionBenchmarkResult> Results);
+	/** Saved/Benchmarks/BDCInteraction_<Receivers>_<timestamp>.csv */
+	static FString GetDefaultOutputPath(int32 Receivers);
+	/** Writes to GetDefaultOutputPath when OutputPath is empty and returns the path written, or an empty string on failure. */
+	static FString Save(TConstArrayView<FInteractionBenchmarkResult> Results, int32 Receivers, const FString& OutputPath = FString());
+};
+
+#endif
@@ -13,6 +13,7 @@
 #include "Kismet/BlueprintFunctionLibrary.h"
 #include "BDC_InteractionLibrary.generated.h"
 
+class UBDC_InteractionSubsystem;
 
 UCLASS()
 class BDC_INTERACTIONBACKEND_API UBDC_InteractionLibrary : public UBlueprintFunctionLibrary
@@ -20,6 +21,9 @@ class BDC_INTERACTIONBACKEND_API UBDC_InteractionLibrary : public UBlueprintFunc
 	GENERATED_BODY()
 
 public:
+	/** Resolves the subsystem, remembering the last world so repeated calls from it skip the world -> game instance -> subsystem walk. */
+	static UBDC_InteractionSubsystem* GetInteractionSubsystem(const UObject* WorldContextObject);
+
 	UFUNCTION(BlueprintCallable, Category = "BDC|Interaction|Library", meta = (WorldContext = "WorldContextObject"))
 	static void SetInstigator(const UObject* WorldContextObject, UInteractionInstigatorComponent* NewInstigator);
 
@@ -61,4 +65,48 @@ public:
 
 	UFUNCTION(BlueprintPure, Category = "BDC|Interaction|Library", meta = (WorldContext = "WorldContextObject"))
 	static void GetCurrentBestFitting(const UObject* WorldContextObject, FInteractionReceivers& BestFit);
+
+	UFUNCTION(BlueprintCallable, Category = "BDC|Interaction|Library", meta = (WorldContext = "WorldContextObject"))
+	static void UpdateAllInstigators(const UObject* WorldContextObject);
+
+	UFUNCTION(BlueprintCallable, Category = "BDC|Interaction|Library", meta = (WorldContext = "WorldContextObject"))
+	static void InjectInteractionFor(const UObject* WorldContextObject, UInteractionInstigatorComponent* ForInstigator);
+
+	UFUNCTION(BlueprintPure, Category = "BDC|Interaction|Library", meta = (WorldContext = "WorldContextObject"))
+	static void GetAllReceiversFieldOf(const UObject* WorldContextObject, UInteractionInstigatorComponent* ForInstigator, TArray<UInteractionReceiverComponent*>& Receivers);
+
+	UFUNCTION(BlueprintPure, Category = "BDC|Interaction|Library", meta = (WorldContext = "WorldContextObject"))
+	static void GetAllReceiversInViewOf(const UObject* WorldContextObject, UInteractionInstigatorComponent* ForInstigator, TArray<FInteractionReceivers>& OutReceiversInView);
+
+	UFUNCTION(BlueprintPure, Category = "BDC|Interaction|Library", meta = (WorldContext = "WorldContextObject"))
+	static void GetCurrentBestFittingOf(const UObject* WorldContextObject, UInteractionInstigatorComponent* ForInstigator, FInteractionReceivers& BestFit);
+
+	UFUNCTION(BlueprintCallable, Category = "BDC|Interaction|Library", meta = (WorldContext = "WorldContextObject"))
+	static void CalcNextBestFor(const UObject* WorldContextObject, UInteractionInstigatorComponent* ForInstigator);
+
+	UFUNCTION(BlueprintCallable, Category = "BDC|Interaction|Library", meta = (WorldContext = "WorldContextObject"))
+	static void CalcPrevBestFor(const UObject* WorldContextObject, UInteractionInstigatorComponent* ForInstigator);
+
+	UFUNCTION(BlueprintPure, Category = "BDC|Interaction|Library", meta = (WorldContext = "WorldContextObject"))
+	static void GetReceiversByName(const UObject* WorldContextObject, FName OfReceiverName, TArray<FInteractionReceivers>& Receivers);
+
+	UFUNCTION(BlueprintPure, Category = "BDC|Interaction|Library", meta = (WorldContext = "WorldContextObject"))
+	static void GetReceiversByTag(const UObject* WorldContextObject, FGameplayTag OfReceiverTag, bool bIncludeChildTags, TArray<FInteractionReceivers>& Receivers);
+
+	UFUNCTION(BlueprintPure, Category = "BDC|Interaction|Library", meta = (WorldContext = "WorldContextObject"))
+	static void GetInstigatorsByTag(const UObject* WorldContextObject, FGameplayTag OfInstigatorTag, bool bIncludeChildTags, TArray<FInteractionReceivers>& Instigators);
+
+	UFUNCTION(BlueprintCallable, Category = "BDC|Interaction|Library", meta = (WorldContext = "WorldContextObject"))
+	static void RegisterReceivers(const UObject* WorldContextObject, const TArray<UInteractionReceiverComponent*>& Receivers);
+
+	UFUNCTION(BlueprintCallable, Category = "BDC|Interaction|Library", meta = (WorldContext = "WorldContextObject"))
+	static void UnregisterReceivers(const UObject* WorldContextObject, const TArray<UInteractionReceiverComponent*>& Receivers);
+
+	/** Updates the primary instigator and returns its best fit and view in one node. */
+	UFUNCTION(BlueprintCallable, Category = "BDC|Interaction|Library", meta = (WorldContext = "WorldContextObject"))
+	static void UpdateInteractionsAndGetState(const UObject* WorldContextObject, FVector InstigatorLocation, FRotator InstigatorRotation, FInteractionReceivers& BestFit, TArray<FInteractionReceivers>& ReceiversInView);
+
+	/** Best fit, view and field of an instigator in one node. */
+	UFUNCTION(BlueprintPure, Category = "BDC|Interaction|Library", meta = (WorldContext = "WorldContextObject"))
+	static void GetInteractionStateOf(const UObject* WorldContextObject, UInteractionInstigatorComponent* ForInstigator, FInteractionReceivers& BestFit, TArray<FInteractionReceivers>& ReceiversInView, TArray<UInteractionReceiverComponent*>& ReceiversInField);
 };
\ No newline at end of file
@@ -0,0 +1,134 @@
+/* Copyright © beginning at 2026 - BlackDevilCreations
+ * Author: Patrick Wenzel
+ * All rights reserved.
+ * This file is part of a BlackDevilCreations project and may not be distributed, copied,
+ * or modified without prior written permission from BlackDevilCreations.
+ * Unreal Engine and its associated trademarks are property of Epic Games, Inc.
+ * and are used with permission.
+ */
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+
+/**
+ * Name and gameplay tag index for registered interaction components.
+ * Every entry remembers its position in each bucket, so removal is a swap with the bucket's last entry.
+ * Buckets therefore keep registration order only until the first removal.
+ * Every valid tag is also indexed under its parent tags for hierarchical queries.
+ */
+template <typename ComponentType>
+struct TInteractionLookupIndex
+{
+public:
+	void Reset()
+	{
+		ByName.Reset();
+		ByTag.Reset();
+		ByParentTag.Reset();
+		IndexedKeys.Reset();
+	}
+
+	void Add(ComponentType* Component, FName Name, const FGameplayTag& Tag)
+	{
+		if (!Component) return;
+
+		Remove(Component);
+		FIndexedKeys& Keys = IndexedKeys.Add(Component);
+		Keys.Name = Name;
+		Keys.Tag = Tag;
+		Keys.NameIndex = ByName.FindOrAdd(Name).Add(Component);
+		Keys.TagIndex = ByTag.FindOrAdd(Tag).Add(Component);
+
+		if (Tag.IsValid())
+		{
+			for (const FGameplayTag& ParentTag : Tag.GetGameplayTagParents())
+			{
+				Keys.ParentSlots.Add({ ParentTag, ByParentTag.FindOrAdd(ParentTag).Add(Component) });
+			}
+		}
+	}
+
+	void Remove(ComponentType* Component)
+	{
+		FIndexedKeys Keys;
+		if (!IndexedKeys.RemoveAndCopyValue(Component, Keys)) return;
+
+		RemoveFromBucket(ByName, Keys.Name, Keys.NameIndex, [](FIndexedKeys& Moved) -> int32& { return Moved.NameIndex; });
+		RemoveFromBucket(ByTag, Keys.Tag, Keys.TagIndex, [](FIndexedKeys& Moved) -> int32& { return Moved.TagIndex; });
+
+		for (const FParentSlot& ParentSlot : Keys.ParentSlots)
+		{
+			RemoveFromBucket(ByParentTag, ParentSlot.Tag, ParentSlot.Index, [&ParentSlot](FIndexedKeys& Moved) -> int32&
+			{
+				return Moved.ParentSlots.FindByPredicate([&ParentSlot](const FParentSlot& Slot) { return Slot.Tag == ParentSlot.Tag; })->Index;
+			});
+		}
+	}
+
+	bool Contains(ComponentType* Component) const { return IndexedKeys.Contains(Component); }
+
+	ComponentType* FindFirstByName(FName Name) const
+	{
+		const TArray<ComponentType*>* Bucket = ByName.Find(Name);
+		return Bucket && Bucket->Num() > 0 ? (*Bucket)[0] : nullptr;
+	}
+
+	ComponentType* FindFirstByTag(const FGameplayTag& Tag) const
+	{
+		const TArray<ComponentType*>* Bucket = ByTag.Find(Tag);
+		return Bucket && Bucket->Num() > 0 ? (*Bucket)[0] : nullptr;
+	}
+
+	TConstArrayView<ComponentType*> FindAllByName(FName Name) const
+	{
+		const TArray<ComponentType*>* Bucket = ByName.Find(Name);
+		return Bucket ? TConstArrayView<ComponentType*>(*Bucket) : TConstArrayView<ComponentType*>();
+	}
+
+	/** With bIncludeChildTags a query for "Quest" also returns components tagged "Quest.Main". */
+	TConstArrayView<ComponentType*> FindAllByTag(const FGameplayTag& Tag, bool bIncludeChildTags) const
+	{
+		const TArray<ComponentType*>* Bucket = bIncludeChildTags ? ByParentTag.Find(Tag) : ByTag.Find(Tag);
+		return Bucket ? TConstArrayView<ComponentType*>(*Bucket) : TConstArrayView<ComponentType*>();
+	}
+
+private:
+	struct FParentSlot
+	{
+		FGameplayTag Tag;
+		int32 Index = INDEX_NONE;
+	};
+
+	struct FIndexedKeys
+	{
+		FName Name;
+		FGameplayTag Tag;
+		int32 NameIndex = INDEX_NONE;
+		int32 TagIndex = INDEX_NONE;
+		TArray<FParentSlot, TInlineAllocator<4>> ParentSlots;
+	};
+
+	/** Swaps the bucket's last entry into Index and points that entry's stored position at its new place. */
+	template <typename KeyType, typename IndexOfFunc>
+	void RemoveFromBucket(TMap<KeyType, TArray<ComponentType*>>& Map, const KeyType& Key, int32 Index, IndexOfFunc IndexOf)
+	{
+		TArray<ComponentType*>* Bucket = Map.Find(Key);
+		if (!Bucket || !Bucket->IsValidIndex(Index)) return;
+
+		Bucket->RemoveAtSwap(Index, 1, false);
+		if (Bucket->Num() == 0)
+		{
+			Map.Remove(Key);
+		}
+		else if (Bucket->IsValidIndex(Index))
+		{
+			IndexOf(IndexedKeys.FindChecked((*Bucket)[Index])) = Index;
+		}
+	}
+
+	TMap<FName, TArray<ComponentType*>> ByName;
+	TMap<FGameplayTag, TArray<ComponentType*>> ByTag;
+	TMap<FGameplayTag, TArray<ComponentType*>> ByParentTag;
+	TMap<ComponentType*, FIndexedKeys> IndexedKeys;
+};
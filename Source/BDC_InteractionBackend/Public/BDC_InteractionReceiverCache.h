@@ -0,0 +1,100 @@
+/* Copyright © beginning at 2026 - BlackDevilCreations
+ * Author: Patrick Wenzel
+ * All rights reserved.
+ * This file is part of a BlackDevilCreations project and may not be distributed, copied,
+ * or modified without prior written permission from BlackDevilCreations.
+ * Unreal Engine and its associated trademarks are property of Epic Games, Inc.
+ * and are used with permission.
+ */
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UInteractionReceiverComponent;
+
+enum class EInteractionReceiverFlags : uint32
+{
+	None = 0,
+	Active = 1 << 0,
+	TagFiltered = 1 << 1,
+	RequiresAllTags = 1 << 2,
+	TagFilterOverflow = 1 << 3,
+	LevelInactive = 1 << 4,
+	Dormant = 1 << 5,
+	ShapeCapsule = 1 << 6,
+	ShapeBox = 1 << 7,
+	VerticalLimit = 1 << 8,
+	/** Range plus radius reaches past the grid query radius, so queries pick it up from the large-reach list instead. */
+	LargeReach = 1 << 9,
+
+	TagFilterMask = TagFiltered | RequiresAllTags | TagFilterOverflow,
+	/** Any of these keeps a registered receiver out of the spatial grid. */
+	OutOfGridMask = LevelInactive | Dormant,
+	/** Any of these needs the scalar 3D pass after the 2D range and FoV kernel. */
+	NarrowPhaseMask = ShapeCapsule | ShapeBox | VerticalLimit
+};
+ENUM_CLASS_FLAGS(EInteractionReceiverFlags);
+
+/** Stable reference to a registered receiver. The serial changes whenever its slot is freed, so stale handles never resolve. */
+struct FInteractionReceiverHandle
+{
+	int32 Index = INDEX_NONE;
+	uint32 Serial = 0;
+
+	bool IsSet() const { return Index != INDEX_NONE; }
+	bool operator==(const FInteractionReceiverHandle& Other) const { return Index == Other.Index && Serial == Other.Serial; }
+	bool operator!=(const FInteractionReceiverHandle& Other) const { return !(*this == Other); }
+
+	friend uint32 GetTypeHash(const FInteractionReceiverHandle& Handle)
+	{
+		return HashCombine(::GetTypeHash(Handle.Index), ::GetTypeHash(Handle.Serial));
+	}
+};
+
+struct BDC_INTERACTIONBACKEND_API FInteractionReceiverCache
+{
+public:
+	void Reset();
+	int32 Add(UInteractionReceiverComponent* Receiver, const FVector& Location, float Radius);
+	int32 Remove(UInteractionReceiverComponent* Receiver);
+	void Reserve(int32 NumReceivers);
+	void SetTagFilter(int32 Slot, uint64 Mask, EInteractionReceiverFlags FilterFlags);
+	void SetFlags(int32 Slot, EInteractionReceiverFlags InFlags, bool bSet);
+	void SetShape(int32 Slot, EInteractionReceiverFlags ShapeFlags, const FBox& Bounds, const FTransform& InShapeTransform, const FVector& InBoxExtent, float InRangeOverride, float InMaxVerticalDistance, float InPriority);
+	void Update(UInteractionReceiverComponent* Receiver, const FVector& Location, float Radius);
+
+	int32 FindSlot(UInteractionReceiverComponent* Receiver) const;
+	bool IsActiveSlot(int32 Slot) const { return Flags.IsValidIndex(Slot) && EnumHasAnyFlags(Flags[Slot], EInteractionReceiverFlags::Active); }
+	FVector GetLocation(int32 Slot) const { return FVector(PosX[Slot], PosY[Slot], PosZ[Slot]); }
+	int32 NumSlots() const { return Receivers.Num(); }
+	bool HasFlags(int32 Slot, EInteractionReceiverFlags InFlags) const { return Flags.IsValidIndex(Slot) && EnumHasAllFlags(Flags[Slot], InFlags); }
+	bool HasAnyFlags(int32 Slot, EInteractionReceiverFlags InFlags) const { return Flags.IsValidIndex(Slot) && EnumHasAnyFlags(Flags[Slot], InFlags); }
+
+	FInteractionReceiverHandle GetHandle(int32 Slot) const { return IsActiveSlot(Slot) ? FInteractionReceiverHandle{ Slot, Serials[Slot] } : FInteractionReceiverHandle(); }
+	bool IsValidHandle(const FInteractionReceiverHandle& Handle) const { return IsActiveSlot(Handle.Index) && Serials[Handle.Index] == Handle.Serial; }
+	UInteractionReceiverComponent* Resolve(const FInteractionReceiverHandle& Handle) const { return IsValidHandle(Handle) ? Receivers[Handle.Index] : nullptr; }
+
+	TArray<UInteractionReceiverComponent*> Receivers;
+	/** Kept in double so large worlds stay exact; the kernel only narrows the offset to the instigator to float. */
+	TArray<double> PosX;
+	TArray<double> PosY;
+	TArray<double> PosZ;
+	/** Broad-phase radius. For capsules this is the horizontal extent of ShapeBounds, for boxes the horizontal reach of their rotated corners. */
+	TArray<float> Radius;
+	/** Per-receiver interaction range, or zero for the global range. */
+	TArray<float> RangeOverride;
+	TArray<float> MaxVerticalDistance;
+	TArray<float> Priority;
+	/** World-space AABB of capsule and box shapes, refreshed whenever the receiver moves. */
+	TArray<FBox> ShapeBounds;
+	/** World transform and local half size of box shapes, so the narrow phase measures against the rotated box. */
+	TArray<FTransform> ShapeTransforms;
+	TArray<FVector> BoxExtents;
+	TArray<EInteractionReceiverFlags> Flags;
+	TArray<uint64> RequiredTagMask;
+	TArray<uint32> Serials;
+
+private:
+	TMap<UInteractionReceiverComponent*, int32> SlotOfReceiver;
+	TArray<int32> FreeSlots;
+};
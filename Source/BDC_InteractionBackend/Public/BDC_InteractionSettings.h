@@ -25,6 +25,88 @@ public:
 	
 	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category="Interaction", meta = (ClampMin = "1", ClampMax = "360"))
 	float InteractionFoV;
+
+	/** Keeps only the best N receivers in view; the rest of the field is still tracked. 0 keeps every receiver in view. */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category="Interaction", meta = (ClampMin = "0"))
+	int32 MaxReceiversInView;
+
+	/** Ranks the view by a weighted score instead of plain distance. */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category="Scoring")
+	bool bUseWeightedScoring;
+
+	/** Penalty per full interaction range of distance. */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category="Scoring", meta = (ClampMin = "0", EditCondition = "bUseWeightedScoring"))
+	float DistanceWeight;
+
+	/** Bonus for facing the receiver head-on, scaled by the cosine to the view center. */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category="Scoring", meta = (ClampMin = "0", EditCondition = "bUseWeightedScoring"))
+	float AngleWeight;
+
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category="Scoring", meta = (EditCondition = "bUseWeightedScoring"))
+	float PriorityWeight;
+
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category="Scoring", meta = (EditCondition = "bUseWeightedScoring"))
+	float RecentInteractionBonus;
+
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category="Scoring", meta = (ClampMin = "0", EditCondition = "bUseWeightedScoring"))
+	float RecentInteractionWindow;
+
+	/**
+	 * Margin another receiver has to beat the current best fit by before the best fit changes.
+	 * Measured in score units, or in centimetres of distance while weighted scoring is off.
+	 */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category="Scoring", meta = (ClampMin = "0"))
+	float BestFitHysteresis;
+
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category="Auto Update")
+	bool bAutoUpdateInteractions;
+
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category="Auto Update", meta = (ClampMin = "0", EditCondition = "bAutoUpdateInteractions"))
+	float ActiveUpdateInterval;
+
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category="Auto Update", meta = (ClampMin = "0", EditCondition = "bAutoUpdateInteractions"))
+	float IdleUpdateInterval;
+
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category="Auto Update", meta = (ClampMin = "0", EditCondition = "bAutoUpdateInteractions"))
+	float AutoUpdateMovementThreshold;
+
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category="Auto Update", meta = (ClampMin = "0", EditCondition = "bAutoUpdateInteractions"))
+	float AutoUpdateRotationThreshold;
+
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category="Performance", meta = (ClampMin = "50"))
+	float SpatialGridCellSize;
+
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category="Performance")
+	bool bUseAsyncLineOfSight;
+
+	/** Reuses trace results per instigator cell for LineOfSightCacheLifetime, so a closing door can read as open until then. Opt-in. */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category="Performance")
+	bool bCacheLineOfSight;
+
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category="Performance", meta = (ClampMin = "1", EditCondition = "bCacheLineOfSight"))
+	float LineOfSightCacheQuantization;
+
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category="Performance", meta = (ClampMin = "0", EditCondition = "bCacheLineOfSight"))
+	float LineOfSightCacheLifetime;
+
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category="Performance")
+	bool bUseCoarseOcclusion;
+
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category="Performance")
+	bool bBatchInteractionEvents;
+
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category="Performance")
+	bool bTimeSliceUpdates;
+
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category="Performance", meta = (ClampMin = "0", EditCondition = "bTimeSliceUpdates"))
+	int32 TimeSliceReceiverBudget;
+
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category="Performance", meta = (ClampMin = "0", EditCondition = "bTimeSliceUpdates"))
+	float TimeSliceMicrosecondBudget;
+
+	/** Interaction requests the server accepts per instigator and second; the rest are rejected unevaluated. 0 accepts every request. */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category="Networking", meta = (ClampMin = "0"))
+	int32 MaxInteractionRequestsPerSecond;
 	
 public:
 	#if WITH_EDITOR
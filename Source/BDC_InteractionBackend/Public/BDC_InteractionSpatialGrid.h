@@ -0,0 +1,36 @@
+/* Copyright © beginning at 2026 - BlackDevilCreations
+ * Author: Patrick Wenzel
+ * All rights reserved.
+ * This file is part of a BlackDevilCreations project and may not be distributed, copied,
+ * or modified without prior written permission from BlackDevilCreations.
+ * Unreal Engine and its associated trademarks are property of Epic Games, Inc.
+ * and are used with permission.
+ */
+#pragma once
+
+#include "CoreMinimal.h"
+
+/** Uniform 2D grid over receiver cache slots, so queries hand slots straight to the SoA kernel. */
+struct BDC_INTERACTIONBACKEND_API FInteractionSpatialGrid
+{
+public:
+	void Reset(float InCellSize);
+	void Add(int32 Slot, const FVector& Location);
+	void Remove(int32 Slot);
+	void Move(int32 Slot, const FVector& NewLocation);
+	void Query(const FVector& Center, float Radius, TArray<int32>& OutSlots) const;
+
+	int32 Num() const { return NumSlots; }
+	bool Contains(int32 Slot) const { return SlotInGrid.IsValidIndex(Slot) && SlotInGrid[Slot]; }
+	float GetCellSize() const { return CellSize; }
+
+private:
+	FIntPoint GetCell(const FVector& Location) const;
+
+	float CellSize = 500.0f;
+	TMap<FIntPoint, TArray<int32>> Cells;
+	/** Cell of every slot in the grid, indexed by slot. */
+	TArray<FIntPoint> SlotCells;
+	TBitArray<> SlotInGrid;
+	int32 NumSlots = 0;
+};
@@ -10,12 +10,21 @@
 
 #include "CoreMinimal.h"
 #include "GameplayTagContainer.h"
+#include "BDC_InteractionLookupIndex.h"
+#include "BDC_InteractionReceiverCache.h"
+#include "BDC_InteractionSpatialGrid.h"
 #include "Components/InteractionReceiver.h"
 #include "GameFramework/Actor.h"
 #include "Subsystems/GameInstanceSubsystem.h"
+#include "Tickable.h"
+#include "UObject/ObjectKey.h"
+#include "WorldCollision.h"
 #include "BDC_InteractionSubsystem.generated.h"
 
 class UInteractionInstigatorComponent;
+class UInteractionOccluderComponent;
+class UBDC_InteractionSettings;
+class ULevel;
 
 USTRUCT(BlueprintType)
 struct FInteractionReceivers
@@ -34,44 +43,295 @@ public:
 	}
 };
 
-DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnFoundReceivers, const TArray<UInteractionReceiverComponent*>&, NewReceivers);
-DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnLostReceivers, const TArray<UInteractionReceiverComponent*>&, ReceiversGone);
-DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnInteractionFired, UInteractionReceiverComponent*, OnReceivers);
+struct FInteractionLineOfSightResult
+{
+	bool bLineOfSightClear = false;
+	bool bTracePending = false;
+	/** Sweep of the owning instigator the last result landed in; zero until the first one arrives. */
+	uint32 ResultSweep = 0;
+	/** Sweep of the owning instigator the pending trace was issued in. */
+	uint32 IssuedSweep = 0;
+};
 
-UCLASS()
-class BDC_INTERACTIONBACKEND_API UBDC_InteractionSubsystem : public UGameInstanceSubsystem
+struct FInteractionLineOfSightCacheEntry
+{
+	FIntVector InstigatorCell = FIntVector::ZeroValue;
+	bool bLineOfSightClear = false;
+	double Timestamp = 0.0;
+};
+
+/** Receiver cache slots registered from one level. Receivers of an inactive level stay registered but are kept out of the spatial grid. */
+struct FInteractionLevelBucket
+{
+	TArray<int32> Slots;
+	bool bActive = true;
+};
+
+/** Level bucket membership of a receiver cache slot. */
+struct FInteractionReceiverLevelEntry
+{
+	TObjectKey<ULevel> Level;
+	int32 BucketIndex = INDEX_NONE;
+};
+
+/** Entry of the dormant side list. WakeTime is in world seconds, or negative to stay dormant until woken. */
+struct FInteractionDormantReceiver
+{
+	int32 Slot = INDEX_NONE;
+	double WakeTime = -1.0;
+};
+
+struct FInteractionCandidate
+{
+	UInteractionReceiverComponent* Receiver = nullptr;
+	int32 Slot = INDEX_NONE;
+	FVector Location = FVector::ZeroVector;
+	float Radius = 0.0f;
+	float Range = 0.0f;
+	EInteractionReceiverFlags Flags = EInteractionReceiverFlags::None;
+	float EffectiveDistance = 0.0f;
+	/** Cosine between the view direction and the receiver on the ground plane. */
+	float ViewCosine = 0.0f;
+	bool bInRange = false;
+	bool bInView = false;
+};
+
+/** Inputs of the best-fit score, all taken from data the update already has at hand. */
+struct FInteractionScoreInput
+{
+	const UInteractionReceiverComponent* Receiver = nullptr;
+	float EffectiveDistance = 0.0f;
+	float Range = 0.0f;
+	float ViewCosine = 0.0f;
+	float Priority = 0.0f;
+	bool bRecentlyInteracted = false;
+};
+
+DECLARE_DELEGATE_RetVal_OneParam(float, FInteractionScoreDelegate, const FInteractionScoreInput&);
+
+struct FInteractionViewEntry
+{
+	/** Higher is better. Negative effective distance unless weighted scoring is enabled. */
+	float Score = 0.0f;
+	UInteractionReceiverComponent* Receiver = nullptr;
+};
+
+struct FInteractionOccluder
+{
+	UInteractionOccluderComponent* Component = nullptr;
+	AActor* Owner = nullptr;
+	FBox Bounds = FBox(ForceInit);
+	FTransform Transform = FTransform::Identity;
+	FVector Extent = FVector::ZeroVector;
+};
+
+USTRUCT()
+struct FInstigatorInteractionState
 {
 	GENERATED_BODY()
-	
-private:
-	UPROPERTY()
-	FTransform InstigatorTransform = FTransform();
-	
+
+public:
 	UPROPERTY()
-	UInteractionInstigatorComponent* Instigator;
+	UInteractionInstigatorComponent* Instigator = nullptr;
 
 	UPROPERTY()
-	TArray<UInteractionInstigatorComponent*> InstigatorsOfLevel;
+	FTransform InstigatorTransform = FTransform();
 
 	UPROPERTY()
 	FInteractionReceivers LastInteractedWith;
-	
+
 	UPROPERTY()
 	FInteractionReceivers CurrentBestFittingReceiver;
-	
+
 	UPROPERTY()
 	TArray<UInteractionReceiverComponent*> ReceiversInField;
 
+	/** Receiver cache slots, parallel to ReceiversInField. */
+	TArray<int32> FieldSlots;
+
 	UPROPERTY()
 	TArray<UInteractionReceiverComponent*> ReceiversInView;
 
+	/** ReceiversInView as Blueprint entries, rebuilt only when the view changes. */
+	UPROPERTY()
+	TArray<FInteractionReceivers> ViewReceivers;
+
 	UPROPERTY()
 	int32 CurrentBestReceiverIndex = 0;
+
+	/** The best fit is below the top entry only because of BestFitHysteresis, so every commit has to re-check the margin. */
+	bool bBestHeldByHysteresis = false;
+
+	TMap<FInteractionReceiverHandle, FInteractionLineOfSightResult> AsyncLineOfSightResults;
+	TMap<FInteractionReceiverHandle, FInteractionLineOfSightCacheEntry> LineOfSightCache;
+
+	TArray<UInteractionReceiverComponent*> PendingReceiversInField;
+	TArray<int32> PendingFieldSlots;
+	TArray<FInteractionViewEntry> PendingViewEntries;
+
+	/** Swapped with ReceiversInView on commit, so both buffers keep their capacity. */
+	TArray<UInteractionReceiverComponent*> PendingReceiversInView;
+	TArray<FInteractionCandidate> SweepCandidates;
+	int32 SweepCursor = 0;
+	/** Counts passes over the candidates: one per full update, or one per time-sliced sweep. */
+	uint32 SweepSerial = 0;
+	/** InstigatingTags folded into receiver filter bits; stale once TagMaskSerial lags the subsystem's TagFilterSerial. */
+	uint64 InstigatorTagMask = 0;
+	uint32 TagMaskSerial = 0;
+	/** Occluders around SweepOccluderCenter, kept across sweeps and chunks; stale once the subsystem's OccluderSerial moves on. */
+	TArray<const FInteractionOccluder*> SweepOccluders;
+	FVector SweepOccluderCenter = FVector::ZeroVector;
+	float SweepOccluderRadius = -1.0f;
+	uint32 SweepOccluderSerial = 0;
+	double LastUpdateTime = -1.0;
+	double LastInteractionTime = -1.0;
+	/** Engine frame and world time of the last full validation; further requests in that frame reuse its view. */
+	uint64 ValidationFrame = MAX_uint64;
+	double ValidationTime = -1.0;
+	/** Real time the current one-second request window opened at, and the requests counted in it. */
+	double RequestWindowStart = -1.0;
+	int32 RequestsInWindow = 0;
+};
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnFoundReceivers, const TArray<UInteractionReceiverComponent*>&, NewReceivers);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnLostReceivers, const TArray<UInteractionReceiverComponent*>&, ReceiversGone);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnInteractionFired, UInteractionReceiverComponent*, OnReceivers);
+
+DECLARE_MULTICAST_DELEGATE_ThreeParams(FOnInteractionFieldChangedNative, UInteractionInstigatorComponent*, UInteractionReceiverComponent*, bool /*bEntered*/);
+DECLARE_MULTICAST_DELEGATE_ThreeParams(FOnBestFittingChangedNative, UInteractionInstigatorComponent*, UInteractionReceiverComponent* /*OldBest*/, UInteractionReceiverComponent* /*NewBest*/);
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnReceiversChangedNative, TConstArrayView<UInteractionReceiverComponent*>);
+
+struct FInteractionQueuedBestFit
+{
+	UInteractionReceiverComponent* OldBest = nullptr;
+	UInteractionReceiverComponent* NewBest = nullptr;
+};
+
+UCLASS()
+class BDC_INTERACTIONBACKEND_API UBDC_InteractionSubsystem : public UGameInstanceSubsystem, public FTickableGameObject
+{
+	GENERATED_BODY()
+	
+private:
+	UPROPERTY()
+	UInteractionInstigatorComponent* Instigator;
+
+	UPROPERTY()
+	TArray<UInteractionInstigatorComponent*> InstigatorsOfLevel;
+
+	UPROPERTY()
+	TMap<UInteractionInstigatorComponent*, FInstigatorInteractionState> InstigatorStates;
 	
+	/** Indexed by receiver cache slot; free slots hold an empty entry. */
 	UPROPERTY()
 	TArray<FInteractionReceivers> ReceiversOfLevel;
 
+	FInteractionSpatialGrid ReceiverGrid;
+	FInteractionReceiverCache ReceiverCache;
+	/** Slots flagged LargeReach. Kept apart from the grid query so one long-range receiver does not widen every query. */
+	TArray<int32> LargeReachSlots;
+	/** Global range the LargeReach flags were last classified against. */
+	float ReachClassifiedRange = 0.0f;
+
+	TMap<TObjectKey<ULevel>, FInteractionLevelBucket> LevelBuckets;
+	/** Indexed by receiver cache slot. */
+	TArray<FInteractionReceiverLevelEntry> ReceiverLevelEntries;
+	FDelegateHandle LevelAddedHandle;
+	FDelegateHandle LevelRemovedHandle;
+	FDelegateHandle WorldCleanupHandle;
+
+	/** Compact list of dormant receivers, kept apart from the grid so scans never see them. */
+	TArray<FInteractionDormantReceiver> DormantReceivers;
+	/** Index into DormantReceivers per receiver cache slot. */
+	TArray<int32> DormantIndices;
+	double NextDormantWakeTime = TNumericLimits<double>::Max();
+
+	/** Per-slot generation stamps used to diff old and new field sets in linear time. */
+	TArray<uint32> FieldStamps;
+	uint32 FieldGeneration = 0;
+
+	TArray<FInteractionOccluder> Occluders;
+	TMap<UInteractionOccluderComponent*, int32> OccluderIndices;
+	/** Bumped whenever an occluder is added, moved or removed, so gathered instigator lists know to regather. */
+	uint32 OccluderSerial = 1;
+
+	/** Net field change per instigator/receiver pair since the last flush; +1 entered, -1 left, 0 cancelled out. */
+	TMap<TPair<UInteractionInstigatorComponent*, UInteractionReceiverComponent*>, int32> QueuedFieldChanges;
+	TMap<UInteractionInstigatorComponent*, FInteractionQueuedBestFit> QueuedBestFitChanges;
+	TMap<TPair<UInteractionInstigatorComponent*, UInteractionReceiverComponent*>, int32> FlushingFieldChanges;
+	TMap<UInteractionInstigatorComponent*, FInteractionQueuedBestFit> FlushingBestFitChanges;
+	TArray<UInteractionReceiverComponent*> FoundReceiversScratch;
+	TArray<UInteractionReceiverComponent*> LostReceiversScratch;
+	bool bFlushingEvents = false;
+
+	/** Frame scratch reused by every update so steady-state updates do not touch the heap. */
+	TArray<FInteractionCandidate> CandidateScratch;
+	TArray<int32> GridQueryScratch;
+	TArray<UInteractionReceiverComponent*> AddedReceiversScratch;
+	TArray<UInteractionReceiverComponent*> RemovedReceiversScratch;
+	TArray<UInteractionInstigatorComponent*> InstigatorScratch;
+	bool bIteratingInstigators = false;
+
+	/** Bit assigned to every gameplay tag a receiver filters on. Tags beyond 64 fall back to container checks. */
+	TMap<FGameplayTag, int32> TagFilterBits;
+	/** Bumped whenever TagFilterBits changes, so cached instigator masks know to recompile. */
+	uint32 TagFilterSerial = 1;
+
+	TInteractionLookupIndex<UInteractionReceiverComponent> ReceiverLookup;
+	TInteractionLookupIndex<UInteractionInstigatorComponent> InstigatorLookup;
+
+	FInstigatorInteractionState& GetOrAddState(UInteractionInstigatorComponent* ForInstigator);
+	const FInstigatorInteractionState* FindState(UInteractionInstigatorComponent* ForInstigator) const;
+	int32 RegisterReceiverInternal(UInteractionReceiverComponent* ReceiverComp, AActor* ReceiverActor);
+	void AddToLevelBucket(int32 Slot, UInteractionReceiverComponent* ReceiverComp);
+	void RemoveFromLevelBucket(int32 Slot);
+	void RemoveFromDormantList(int32 Slot);
+	void WakeDueReceivers(double CurrentTime);
+	void OnLevelAddedToWorld(ULevel* Level, UWorld* World);
+	void OnLevelRemovedFromWorld(ULevel* Level, UWorld* World);
+	void OnWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources);
+	void CompileReceiverTagFilter(int32 Slot, const UInteractionReceiverComponent* ReceiverComp);
+	void CompileReceiverShape(int32 Slot, const UInteractionReceiverComponent* ReceiverComp, const FTransform& ReceiverTransform);
+	void RefineCandidates(const FVector& InstigatorLocation, TArrayView<FInteractionCandidate> Candidates) const;
+	float GetBroadPhaseRadius(float GlobalRange) const;
+	void ClassifyReceiverReach(int32 Slot);
+	void ReclassifyReceiverReach(float GlobalRange);
+	uint64 CompileInstigatorTagMask(const UInteractionInstigatorComponent* InstigatorComp) const;
+	uint64 GetInstigatorTagMask(FInstigatorInteractionState& State) const;
+	bool PassesTagFilter(int32 Slot, uint64 InstigatorTagMask, const UInteractionInstigatorComponent* InstigatorComp) const;
+	TConstArrayView<const FInteractionOccluder*> GetNearbyOccluders(const UBDC_InteractionSettings* Settings, FInstigatorInteractionState& State, const FVector& InstigatorLocation) const;
+	void GatherCandidates(const UBDC_InteractionSettings* Settings, const FVector& Center, TArray<FInteractionCandidate>& OutCandidates);
+	void RunInstigatorUpdate(UWorld* World, const UBDC_InteractionSettings* Settings, FInstigatorInteractionState& State, const FVector& InstigatorLocation, const FRotator& InstigatorRotation, TArray<FInteractionCandidate>& Candidates);
+	void UpdateInstigatorState(UWorld* World, const UBDC_InteractionSettings* Settings, FInstigatorInteractionState& State, const FVector& InstigatorLocation, const FRotator& InstigatorRotation, TArray<FInteractionCandidate>& Candidates, bool bBlockingLineOfSight);
+	void UpdateInstigatorStateSliced(UWorld* World, const UBDC_InteractionSettings* Settings, FInstigatorInteractionState& State, const FVector& InstigatorLocation, const FRotator& InstigatorRotation);
+	void ProcessCandidates(UWorld* World, const UBDC_InteractionSettings* Settings, FInstigatorInteractionState& State, const FVector& InstigatorLocation, const FRotator& InstigatorRotation, TArrayView<FInteractionCandidate> Candidates, bool bBlockingLineOfSight);
+	void CommitInstigatorState(FInstigatorInteractionState& State);
+	void FireInteraction(FInstigatorInteractionState& State, UInteractionInstigatorComponent* ForInstigator, UInteractionReceiverComponent* Receiver);
+	float ScoreCandidate(const UBDC_InteractionSettings* Settings, const FInteractionCandidate& Candidate, bool bRecentlyInteracted) const;
+	int32 SelectBestReceiverIndex(TConstArrayView<FInteractionViewEntry> SortedEntries, const UInteractionReceiverComponent* OldBest) const;
+	void EvaluateCandidates(const UBDC_InteractionSettings* Settings, const FVector& InstigatorLocation, const FVector& InstigatorForward, TArrayView<FInteractionCandidate> Candidates);
+	void CycleBest(FInstigatorInteractionState& State, int32 Direction);
+	void QueueFieldChange(UInteractionInstigatorComponent* ForInstigator, UInteractionReceiverComponent* ReceiverComp, int32 Delta);
+	void QueueBestFitChange(UInteractionInstigatorComponent* ForInstigator, UInteractionReceiverComponent* OldBest, UInteractionReceiverComponent* NewBest);
+	void DispatchQueuedEventsUnlessBatched();
+	void DrawDebugInstigators(const UWorld* World, const UBDC_InteractionSettings* Settings) const;
+	void UpdateScratchMemoryStat() const;
+
+	/** bBlockingLineOfSight traces synchronously and skips the cache, for checks that have to hold in this very frame. */
+	bool HasLineOfSight(UWorld* World, const UBDC_InteractionSettings* Settings, FInstigatorInteractionState& State, const FVector& From, const FInteractionReceiverHandle& ReceiverHandle, UInteractionReceiverComponent* ReceiverComp, const FVector& ReceiverLocation, AActor* InstigatorActor, TConstArrayView<const FInteractionOccluder*> NearbyOccluders, bool bBlockingLineOfSight);
+	static FIntVector QuantizeInstigatorLocation(const UBDC_InteractionSettings* Settings, const FVector& Location);
+	void OnLineOfSightTraceDone(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum, FInteractionReceiverHandle ReceiverHandle, UInteractionInstigatorComponent* StateKey, FIntVector InstigatorCell);
+
 public: 
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	virtual void Tick(float DeltaTime) override;
+	virtual ETickableTickType GetTickableTickType() const override;
+	virtual bool IsTickable() const override;
+	virtual UWorld* GetTickableGameObjectWorld() const override;
+	virtual TStatId GetStatId() const override;
+
 	UPROPERTY(BlueprintAssignable, Category = "BDC|Interaction|Dispatchers|Subsystem")
 	FOnFoundReceivers OnFoundReceivers;
 	UPROPERTY(BlueprintAssignable, Category = "BDC|Interaction|Dispatchers|Subsystem")
@@ -79,8 +339,22 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = "BDC|Interaction|Dispatchers|Subsystem")
 	FOnInteractionFired OnInteractionFired;
 
+	/** Native counterparts of the dispatchers above, for C++ listeners that want to skip the reflection cost. */
+	FOnInteractionFieldChangedNative OnFieldChangedNative;
+	FOnBestFittingChangedNative OnBestFittingChangedNative;
+	FOnReceiversChangedNative OnFoundReceiversNative;
+	FOnReceiversChangedNative OnLostReceiversNative;
+
+	/** Replaces the built-in weighted score when bound. Only used while bUseWeightedScoring is set; called on the game thread once per candidate in view, so keep it cheap. */
+	FInteractionScoreDelegate CustomScoring;
+
+	/** Dispatches every queued field and best-fit change. Runs once per frame when bBatchInteractionEvents is set. */
+	void FlushInteractionEvents();
+	bool HasQueuedInteractionEvents() const { return QueuedFieldChanges.Num() > 0 || QueuedBestFitChanges.Num() > 0; }
+
 	void SetInstigator(UInteractionInstigatorComponent* NewInstigator);
 	void GetLastInteraction(FInteractionReceivers& LastReceiver) const;
+	void GetLastInteractionOf(UInteractionInstigatorComponent* ForInstigator, FInteractionReceivers& LastReceiver) const;
 	void InjectInteraction();
 	void UpdateInteractions(FVector InstigatorLocation, FRotator InstigatorRotation);
 	void GetAllReceiversField(TArray<UInteractionReceiverComponent*>& Receivers) const;
@@ -91,6 +365,7 @@ public:
 	void GetInstigatorByName(FName OfInstigatorName, FInteractionReceivers& InstigatorData) const;
 	void AddReceiver(FInteractionReceivers NewReceiver);
 	void RemoveReceiver(UInteractionReceiverComponent* ReceiverComponent);
+	void UpdateReceiverLocation(UInteractionReceiverComponent* ReceiverComponent);
 	void AddInstigator(UInteractionInstigatorComponent* NewInstigator);
 	void RemoveInstigator(UInteractionInstigatorComponent* InstigatorComponent);
 
@@ -98,4 +373,52 @@ public:
 	void CalcNextBest();
 	void CalcPrevBest();
 	void GetCurrentBestFitting(FInteractionReceivers& BestFit) const;
+
+	void UpdateAllInstigators();
+	/** Updates one instigator from the given transform without touching the subsystem's current instigator. */
+	void UpdateInteractionsFor(UInteractionInstigatorComponent* ForInstigator, FVector InstigatorLocation, FRotator InstigatorRotation);
+	void InjectInteractionFor(UInteractionInstigatorComponent* ForInstigator);
+	/**
+	 * Server side of UInteractionInstigatorComponent::RequestInteraction. Re-evaluates the instigator from its
+	 * authoritative transform and only fires if ExpectedReceiver (or the best fit when null) is in its view.
+	 * Requests beyond MaxInteractionRequestsPerSecond are rejected without an evaluation.
+	 */
+	bool InjectValidatedInteractionFor(UInteractionInstigatorComponent* ForInstigator, UInteractionReceiverComponent* ExpectedReceiver);
+	void GetAllReceiversFieldOf(UInteractionInstigatorComponent* ForInstigator, TArray<UInteractionReceiverComponent*>& Receivers) const;
+	void GetAllReceiversInViewOf(UInteractionInstigatorComponent* ForInstigator, TArray<FInteractionReceivers>& OutReceiversInView) const;
+	void GetCurrentBestFittingOf(UInteractionInstigatorComponent* ForInstigator, FInteractionReceivers& BestFit) const;
+
+	/** Non-copying views over the internal state. Only valid until the next update or registration change. */
+	TConstArrayView<UInteractionReceiverComponent*> GetReceiversInFieldView(UInteractionInstigatorComponent* ForInstigator) const;
+	TConstArrayView<UInteractionReceiverComponent*> GetReceiversInViewView(UInteractionInstigatorComponent* ForInstigator) const;
+	TConstArrayView<FInteractionReceivers> GetViewReceiversView(UInteractionInstigatorComponent* ForInstigator) const;
+	void ForEachReceiverOfLevel(TFunctionRef<void(const FInteractionReceivers&)> Visitor) const;
+	void CalcNextBestFor(UInteractionInstigatorComponent* ForInstigator);
+	void CalcPrevBestFor(UInteractionInstigatorComponent* ForInstigator);
+
+	void GetReceiversByName(FName OfReceiverName, TArray<FInteractionReceivers>& OutReceivers) const;
+	void GetReceiversByTag(FGameplayTag OfReceiverTag, bool bIncludeChildTags, TArray<FInteractionReceivers>& OutReceivers) const;
+	void GetInstigatorsByTag(FGameplayTag OfInstigatorTag, bool bIncludeChildTags, TArray<FInteractionReceivers>& OutInstigators) const;
+	void RefreshReceiverLookup(UInteractionReceiverComponent* ReceiverComponent);
+	void RefreshInstigatorLookup(UInteractionInstigatorComponent* InstigatorComponent);
+	void RefreshReceiverTagFilter(UInteractionReceiverComponent* ReceiverComponent);
+	void RefreshInstigatorTagMask(UInteractionInstigatorComponent* InstigatorComponent);
+	void RefreshReceiverShape(UInteractionReceiverComponent* ReceiverComponent);
+
+	/** Moves the receivers of a level in or out of the spatial grid. Driven by level visibility, but game code may call it too. */
+	void SetLevelInteractionActive(const ULevel* Level, bool bActive);
+	/** Prefer UInteractionReceiverComponent::SetInteractionDormant/WakeInteraction, which keep the component's state in sync. */
+	void SetReceiverDormant(UInteractionReceiverComponent* ReceiverComponent, bool bDormant, float AutoWakeAfterSeconds = 0.0f);
+	int32 GetNumDormantReceivers() const { return DormantReceivers.Num(); }
+	bool IsLevelInteractionActive(const ULevel* Level) const;
+	/** Drops every receiver, instigator and occluder that belongs to the given world. */
+	void PurgeWorld(const UWorld* World);
+
+	void AddOccluder(UInteractionOccluderComponent* OccluderComponent);
+	void RemoveOccluder(UInteractionOccluderComponent* OccluderComponent);
+
+	void RegisterReceivers(TConstArrayView<UInteractionReceiverComponent*> NewReceivers);
+	void UnregisterReceivers(TConstArrayView<UInteractionReceiverComponent*> ReceiversToRemove);
+	FInteractionReceiverHandle GetReceiverHandle(UInteractionReceiverComponent* ReceiverComponent) const;
+	UInteractionReceiverComponent* ResolveReceiverHandle(const FInteractionReceiverHandle& Handle) const;
 };
\ No newline at end of file
@@ -12,9 +12,60 @@
 #include "Components/ActorComponent.h"
 #include "GameplayTagContainer.h"
 #include "BDC_InteractionSubsystem.h"
+#include "Net/Serialization/FastArraySerializer.h"
 
 #include "InteractionInstigator.generated.h"
 
+struct FInteractionReplicatedReceiverArray;
+
+/** One receiver of the replicated field. The pointer goes over the wire as a NetGUID, so receivers must be net addressable. */
+USTRUCT()
+struct FInteractionReplicatedReceiver : public FFastArraySerializerItem
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	UInteractionReceiverComponent* Receiver = nullptr;
+
+	void PostReplicatedAdd(const FInteractionReplicatedReceiverArray& InArraySerializer);
+	void PreReplicatedRemove(const FInteractionReplicatedReceiverArray& InArraySerializer);
+};
+
+/** Field of an instigator as a fast array, so only entered and left receivers are sent instead of the whole set. */
+USTRUCT()
+struct FInteractionReplicatedReceiverArray : public FFastArraySerializer
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<FInteractionReplicatedReceiver> Items;
+
+	UInteractionInstigatorComponent* Owner = nullptr;
+
+	/** Ignores receivers that are already in the field. */
+	void Add(UInteractionReceiverComponent* Receiver);
+	bool Remove(const UInteractionReceiverComponent* Receiver);
+
+private:
+	/** Index of every receiver in Items. Server side only; clients never call Add or Remove. */
+	TMap<const UInteractionReceiverComponent*, int32> ItemIndices;
+
+public:
+
+	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+	{
+		return FFastArraySerializer::FastArrayDeltaSerialize<FInteractionReplicatedReceiver, FInteractionReplicatedReceiverArray>(Items, DeltaParms, *this);
+	}
+};
+
+template<>
+struct TStructOpsTypeTraits<FInteractionReplicatedReceiverArray> : public TStructOpsTypeTraitsBase2<FInteractionReplicatedReceiverArray>
+{
+	enum { WithNetDeltaSerializer = true };
+};
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnReplicatedInteractionStateChanged);
+
 
 UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
 class BDC_INTERACTIONBACKEND_API UInteractionInstigatorComponent : public UActorComponent
@@ -25,16 +76,18 @@ private:
 	UPROPERTY()
 	USceneComponent* InstigatorComponent;
 
+	void RefreshSubsystemLookup();
+
 public:
 	UInteractionInstigatorComponent();
 
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "BDC|Interaction|Instigator")
 	FName NameOfInteractionComponent = FName("CapsuleComponent");
-	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "BDC|Interaction|Instigator")
+	UPROPERTY(BlueprintReadWrite, BlueprintSetter = SetNameOfInstigator, EditAnywhere, Category = "BDC|Interaction|Instigator")
 	FName NameOfInstigator = FName("Nancy");
-	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "BDC|Interaction|Instigator")
+	UPROPERTY(BlueprintReadWrite, BlueprintSetter = SetTagOfInstigator, EditAnywhere, Category = "BDC|Interaction|Instigator")
 	FGameplayTag TagOfInstigator = FGameplayTag();
-	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "BDC|Interaction|Instigator")
+	UPROPERTY(BlueprintReadWrite, BlueprintSetter = SetInstigatingTags, EditAnywhere, Category = "BDC|Interaction|Instigator")
 	FGameplayTagContainer InstigatingTags = FGameplayTagContainer();
 
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "BDC|Interaction|Instigator")
@@ -46,7 +99,48 @@ public:
 	UFUNCTION(BlueprintCallable, Category="BDC|Interaction|Event")
 	FTransform GetInstigatorTransform() const;
 
+	/** Renames the instigator so GetInstigatorByName finds it under NewName. */
+	UFUNCTION(BlueprintSetter, Category="BDC|Interaction|Instigator")
+	void SetNameOfInstigator(FName NewName);
+	/** Retags the instigator so GetInstigatorsByTag finds it under NewTag. */
+	UFUNCTION(BlueprintSetter, Category="BDC|Interaction|Instigator")
+	void SetTagOfInstigator(FGameplayTag NewTag);
+	/** Changes the tags offered to receiver filters; the subsystem recompiles its cached mask on the next update. */
+	UFUNCTION(BlueprintSetter, Category="BDC|Interaction|Instigator")
+	void SetInstigatingTags(FGameplayTagContainer NewInstigatingTags);
+
+	/** Interacts with the best fit. Fires directly with authority, otherwise asks the server to validate and fire. */
+	UFUNCTION(BlueprintCallable, Category="BDC|Interaction|Event")
+	void RequestInteraction();
+
+	/** Best fit as last seen by the server. Only replicated to the owning client. */
+	UFUNCTION(BlueprintPure, Category="BDC|Interaction|Replication")
+	UInteractionReceiverComponent* GetReplicatedBestFittingReceiver() const { return ReplicatedBestFittingReceiver; }
+	/** Field as last seen by the server. Only replicated to the owning client. */
+	UFUNCTION(BlueprintCallable, Category="BDC|Interaction|Replication")
+	void GetReplicatedReceiversInField(TArray<UInteractionReceiverComponent*>& Receivers) const;
+
+	/** Fires on the owning client whenever the replicated field or best fit changes. */
+	UPROPERTY(BlueprintAssignable, Category="BDC|Interaction|Replication")
+	FOnReplicatedInteractionStateChanged OnReplicatedInteractionStateChanged;
+
+	/** Called by the subsystem after a commit; a no-op without authority or outside a networked game. */
+	void ReplicateInteractionState(TConstArrayView<UInteractionReceiverComponent*> AddedReceivers, TConstArrayView<UInteractionReceiverComponent*> RemovedReceivers, UInteractionReceiverComponent* BestReceiver);
+
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
 protected:
+	UPROPERTY(Replicated)
+	FInteractionReplicatedReceiverArray ReplicatedReceiversInField;
+	UPROPERTY(ReplicatedUsing=OnRep_ReplicatedBestFittingReceiver)
+	UInteractionReceiverComponent* ReplicatedBestFittingReceiver = nullptr;
+
+	UFUNCTION()
+	void OnRep_ReplicatedBestFittingReceiver();
+
+	UFUNCTION(Server, Reliable)
+	void ServerRequestInteraction(UInteractionReceiverComponent* ExpectedReceiver);
+
 	virtual void BeginPlay() override;
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 };
\ No newline at end of file
@@ -0,0 +1,41 @@
+/* Copyright © beginning at 2026 - BlackDevilCreations
+ * Author: Patrick Wenzel
+ * All rights reserved.
+ * This file is part of a BlackDevilCreations project and may not be distributed, copied,
+ * or modified without prior written permission from BlackDevilCreations.
+ * Unreal Engine and its associated trademarks are property of Epic Games, Inc.
+ * and are used with permission.
+ */
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/SceneComponent.h"
+#include "InteractionOccluder.generated.h"
+
+/**
+ * Coarse, solid box the interaction subsystem treats as fully blocking when
+ * bUseCoarseOcclusion is enabled. Receivers behind it are rejected without a line trace.
+ */
+UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
+class BDC_INTERACTIONBACKEND_API UInteractionOccluderComponent : public USceneComponent
+{
+	GENERATED_BODY()
+
+public:
+	UInteractionOccluderComponent();
+
+	UPROPERTY(BlueprintReadWrite, BlueprintSetter = SetBoxExtent, EditAnywhere, Category = "BDC|Interaction|Occluder")
+	FVector BoxExtent = FVector(100.0f, 100.0f, 100.0f);
+
+	/** Refreshes the subsystem's cached box, which otherwise only follows transform changes. */
+	UFUNCTION(BlueprintSetter, Category="BDC|Interaction|Occluder")
+	void SetBoxExtent(FVector NewBoxExtent);
+
+	UFUNCTION(BlueprintCallable, Category="BDC|Interaction|Occluder")
+	FBox GetOccluderBounds() const;
+
+protected:
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	virtual void OnUpdateTransform(EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport) override;
+};
@@ -14,6 +14,19 @@
 #include "Components/SceneComponent.h"
 #include "InteractionReceiver.generated.h"
 
+class UBDC_InteractionSubsystem;
+
+UENUM(BlueprintType)
+enum class EInteractionReceiverShape : uint8
+{
+	/** ReceiverRadius on the ground plane, the classic 2D test. */
+	Sphere,
+	/** Upright capsule of ReceiverRadius and CapsuleHalfHeight, measured in 3D. */
+	Capsule,
+	/** Box of BoxExtent following the receiver's rotation, measured in 3D against the rotated box. */
+	Box
+};
+
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnReceivedInteraction, AActor*, OfInstigator, FName, OfInstigatorName, FGameplayTagContainer, OfInstigatedTags);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnEntersInteractionField, AActor*, OfInstigator, FName, OfInstigatorName);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnLeavesInteractionField, AActor*, OfInstigator, FName, OfInstigatorName);
@@ -29,6 +42,13 @@ private:
 	UPROPERTY()
 	USceneComponent* ReceiverComponent;
 
+	TWeakObjectPtr<UBDC_InteractionSubsystem> OwningSubsystem;
+	bool bInteractionDormant = false;
+	TWeakObjectPtr<USceneComponent> TrackedComponent;
+	FDelegateHandle TransformUpdatedHandle;
+
+	void OnTrackedTransformUpdated(USceneComponent* UpdatedComponent, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport);
+
 public:
 	UInteractionReceiverComponent();
 	
@@ -45,19 +65,80 @@ public:
 	
 	UPROPERTY(BlueprintReadWrite, Editanywhere, Category = "BDC|Interaction|Receiver")
 	FName NameOfInteractionComponent = FName("CapsuleComponent");
-	UPROPERTY(BlueprintReadWrite, Editanywhere, Category = "BDC|Interaction|Receiver")
+	UPROPERTY(BlueprintReadWrite, BlueprintSetter = SetNameOfReceiver, Editanywhere, Category = "BDC|Interaction|Receiver")
 	FName NameOfReceiver = FName("Steven");
-	UPROPERTY(BlueprintReadWrite, Editanywhere, Category = "BDC|Interaction|Receiver")
+	UPROPERTY(BlueprintReadWrite, BlueprintSetter = SetTagOfReceiver, Editanywhere, Category = "BDC|Interaction|Receiver")
 	FGameplayTag TagOfReceiver = FGameplayTag();
-	UPROPERTY(BlueprintReadWrite, Editanywhere, Category = "BDC|Interaction|Receiver")
+	UPROPERTY(BlueprintReadWrite, BlueprintSetter = SetOnlyInteractOnTag, Editanywhere, Category = "BDC|Interaction|Receiver")
 	FGameplayTagContainer OnlyInteractOnTag = FGameplayTagContainer();
-	UPROPERTY(BlueprintReadWrite, Editanywhere, Category = "BDC|Interaction|Receiver")
+	UPROPERTY(BlueprintReadWrite, BlueprintSetter = SetAllTagsHaveToBePresent, Editanywhere, Category = "BDC|Interaction|Receiver")
 	bool bAllTagsHaveToBePresent = false;
-	UPROPERTY(BlueprintReadWrite, Editanywhere, Category = "BDC|Interaction|Receiver")
+	UPROPERTY(BlueprintReadWrite, BlueprintSetter = SetReceiverRadius, Editanywhere, Category = "BDC|Interaction|Receiver")
 	float ReceiverRadius = 25.0f;
+	/** Added to the receiver's score when weighted scoring is enabled. */
+	UPROPERTY(BlueprintReadWrite, BlueprintSetter = SetInteractionPriority, Editanywhere, Category = "BDC|Interaction|Receiver")
+	float InteractionPriority = 0.0f;
+	/** Replaces the global InteractionRange for this receiver. Zero or less uses the global range. */
+	UPROPERTY(BlueprintReadWrite, BlueprintSetter = SetInteractionRangeOverride, Editanywhere, Category = "BDC|Interaction|Receiver")
+	float InteractionRangeOverride = 0.0f;
+	UPROPERTY(BlueprintReadWrite, BlueprintSetter = SetInteractionShapeType, Editanywhere, Category = "BDC|Interaction|Receiver")
+	EInteractionReceiverShape InteractionShape = EInteractionReceiverShape::Sphere;
+	UPROPERTY(BlueprintReadWrite, BlueprintSetter = SetCapsuleHalfHeight, Editanywhere, Category = "BDC|Interaction|Receiver", meta = (EditCondition = "InteractionShape == EInteractionReceiverShape::Capsule"))
+	float CapsuleHalfHeight = 90.0f;
+	UPROPERTY(BlueprintReadWrite, BlueprintSetter = SetBoxExtent, Editanywhere, Category = "BDC|Interaction|Receiver", meta = (EditCondition = "InteractionShape == EInteractionReceiverShape::Box"))
+	FVector BoxExtent = FVector(50.0f);
+	/** Maximum height difference to the instigator, so receivers on other floors are ignored. Zero or less disables the limit. */
+	UPROPERTY(BlueprintReadWrite, BlueprintSetter = SetMaxVerticalDistance, Editanywhere, Category = "BDC|Interaction|Receiver")
+	float MaxVerticalDistance = 0.0f;
+	/** Registers the receiver dormant, e.g. for chests that only become relevant after a quest step. */
+	UPROPERTY(BlueprintReadWrite, Editanywhere, Category = "BDC|Interaction|Receiver")
+	bool bStartDormant = false;
 	
 	UFUNCTION(BlueprintCallable, Category="BDC|Interaction|Event")
 	FTransform GetReceiverTransform() const;
+
+	/** Renames the receiver so GetReceiversByName finds it under NewName. */
+	UFUNCTION(BlueprintSetter, Category="BDC|Interaction|Receiver")
+	void SetNameOfReceiver(FName NewName);
+	/** Retags the receiver so GetReceiversByTag finds it under NewTag. */
+	UFUNCTION(BlueprintSetter, Category="BDC|Interaction|Receiver")
+	void SetTagOfReceiver(FGameplayTag NewTag);
+	/** Changes which instigating tags this receiver accepts and recompiles the subsystem's tag filter. */
+	UFUNCTION(BlueprintCallable, Category="BDC|Interaction|Receiver")
+	void SetInteractionTagFilter(FGameplayTagContainer NewOnlyInteractOnTag, bool bNewAllTagsHaveToBePresent);
+	UFUNCTION(BlueprintSetter, Category="BDC|Interaction|Receiver")
+	void SetOnlyInteractOnTag(FGameplayTagContainer NewOnlyInteractOnTag);
+	UFUNCTION(BlueprintSetter, Category="BDC|Interaction|Receiver")
+	void SetAllTagsHaveToBePresent(bool bNewAllTagsHaveToBePresent);
+	/** Takes effect on the next scoring pass. */
+	UFUNCTION(BlueprintSetter, Category="BDC|Interaction|Receiver")
+	void SetInteractionPriority(float NewPriority);
+	UFUNCTION(BlueprintSetter, Category="BDC|Interaction|Receiver")
+	void SetInteractionRangeOverride(float NewRangeOverride);
+	/** Sets all shape properties at once, so the receiver is recompiled a single time. */
+	UFUNCTION(BlueprintCallable, Category="BDC|Interaction|Receiver")
+	void SetInteractionShape(EInteractionReceiverShape NewShape, float NewCapsuleHalfHeight, FVector NewBoxExtent, float NewMaxVerticalDistance);
+	UFUNCTION(BlueprintSetter, Category="BDC|Interaction|Receiver")
+	void SetInteractionShapeType(EInteractionReceiverShape NewShape);
+	UFUNCTION(BlueprintSetter, Category="BDC|Interaction|Receiver")
+	void SetCapsuleHalfHeight(float NewCapsuleHalfHeight);
+	UFUNCTION(BlueprintSetter, Category="BDC|Interaction|Receiver")
+	void SetBoxExtent(FVector NewBoxExtent);
+	UFUNCTION(BlueprintSetter, Category="BDC|Interaction|Receiver")
+	void SetMaxVerticalDistance(float NewMaxVerticalDistance);
+	UFUNCTION(BlueprintSetter, Category="BDC|Interaction|Receiver")
+	void SetReceiverRadius(float NewReceiverRadius);
+
+	/**
+	 * Takes the receiver out of every range check, trace and sort until it is woken. It stays registered,
+	 * so lookups and handles keep working. A positive AutoWakeAfterSeconds wakes it again on its own.
+	 */
+	UFUNCTION(BlueprintCallable, Category="BDC|Interaction|Receiver")
+	void SetInteractionDormant(float AutoWakeAfterSeconds = 0.0f);
+	UFUNCTION(BlueprintCallable, Category="BDC|Interaction|Receiver")
+	void WakeInteraction();
+	UFUNCTION(BlueprintPure, Category="BDC|Interaction|Receiver")
+	bool IsInteractionDormant() const { return bInteractionDormant; }
 	
 protected:
 	virtual void BeginPlay() override;
@@ -0,0 +1,560 @@
+/* Copyright © beginning at 2026 - BlackDevilCreations
+ * Author: Patrick Wenzel
+ * All rights reserved.
+ * This file is part of a BlackDevilCreations project and may not be distributed, copied,
+ * or modified without prior written permission from BlackDevilCreations.
+ * Unreal Engine and its associated trademarks are property of Epic Games, Inc.
+ * and are used with permission.
+ */
+#include "BDC_InteractionTestFlags.h"
+#include "BDC_InteractionTestWorld.h"
+#include "BDC_InteractionSettings.h"
+#include "BDC_InteractionSubsystem.h"
+#include "Components/InteractionInstigator.h"
+#include "Components/InteractionReceiver.h"
+
+#if WITH_DEV_AUTOMATION_TESTS && WITH_EDITOR
+
+#include "Components/BoxComponent.h"
+#include "Editor.h"
+#include "EngineUtils.h"
+#include "Engine/CollisionProfile.h"
+#include "Engine/GameInstance.h"
+#include "GameFramework/PlayerController.h"
+#include "Settings/LevelEditorPlaySettings.h"
+#include "Tests/AutomationEditorCommon.h"
+
+namespace BDC_InteractionNetworkTest
+{
+	constexpr float SessionTimeout = 30.0f;
+	constexpr float ReplicationTimeout = 10.0f;
+	const FVector Origin(10000.0f, 10000.0f, 5000.0f);
+	const FVector ReceiverOffset(100.0f, 0.0f, 0.0f);
+	const FVector CloserOffset(60.0f, 10.0f, 0.0f);
+
+	/** Everything the latent steps share. Outlives RunTest, so it also owns the settings scope. */
+	struct FContext
+	{
+		TUniquePtr<FInteractionTestSettingsScope> Settings;
+		EPlayNetMode SavedNetMode = PIE_Standalone;
+		int32 SavedNumClients = 1;
+		bool bSavedRunUnderOneProcess = true;
+
+		TWeakObjectPtr<UWorld> ServerWorld;
+		TWeakObjectPtr<UWorld> ClientWorld;
+		TWeakObjectPtr<APlayerController> RemoteController;
+		TWeakObjectPtr<UInteractionInstigatorComponent> ServerInstigator;
+		TWeakObjectPtr<UInteractionInstigatorComponent> ClientInstigator;
+		TWeakObjectPtr<UInteractionReceiverComponent> ServerReceiver;
+		TWeakObjectPtr<UInteractionReceiverComponent> CloserReceiver;
+		bool bFailed = false;
+	};
+
+	static UWorld* FindPIEWorld(ENetMode NetMode)
+	{
+		for (const FWorldContext& Context : GEngine->GetWorldContexts())
+		{
+			UWorld* World = Context.World();
+			if (Context.WorldType == EWorldType::PIE && World && World->GetNetMode() == NetMode)
+			{
+				return World;
+			}
+		}
+		return nullptr;
+	}
+
+	static UBDC_InteractionSubsystem* GetSubsystem(const UWorld* World)
+	{
+		const UGameInstance* GI = World ? World->GetGameInstance() : nullptr;
+		return GI ? GI->GetSubsystem<UBDC_InteractionSubsystem>() : nullptr;
+	}
+
+	/** Always relevant and owned by the client's controller, so owner-only properties and server RPCs reach it. */
+	static AActor* SpawnReplicatedActor(UWorld* World, const FVector& Location, AActor* Owner)
+	{
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.Owner = Owner;
+		SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+		AActor* Actor = World->SpawnActor<AActor>(AActor::StaticClass(), FTransform(Location), SpawnParams);
+		if (!Actor) return nullptr;
+
+		USceneComponent* Root = NewObject<USceneComponent>(Actor, TEXT("Root"));
+		Root->SetMobility(EComponentMobility::Movable);
+		Actor->SetRootComponent(Root);
+		Root->SetWorldLocation(Location);
+		Root->RegisterComponent();
+
+		Actor->bAlwaysRelevant = true;
+		Actor->SetReplicates(true);
+		return Actor;
+	}
+
+	/** Client components are separate objects, so the replicated best fit is matched by where its actor spawned. */
+	static bool IsClientBestFitAt(const FContext& Context, const FVector& Location)
+	{
+		const UInteractionInstigatorComponent* ClientInstigator = Context.ClientInstigator.Get();
+		const UInteractionReceiverComponent* BestFit = ClientInstigator ? ClientInstigator->GetReplicatedBestFittingReceiver() : nullptr;
+		return BestFit && BestFit->GetOwner() && BestFit->GetOwner()->GetActorLocation().Equals(Location, 1.0f);
+	}
+
+	/** Starts a listen server with one remote client and waits until both worlds are connected. */
+	static void StartListenServerSession(FAutomationTestBase& Test, const TSharedRef<FContext>& Context)
+	{
+		ULevelEditorPlaySettings* PlaySettings = GetMutableDefault<ULevelEditorPlaySettings>();
+		PlaySettings->GetPlayNetMode(Context->SavedNetMode);
+		PlaySettings->GetPlayNumberOfClients(Context->SavedNumClients);
+		PlaySettings->GetRunUnderOneProcess(Context->bSavedRunUnderOneProcess);
+		PlaySettings->SetPlayNetMode(PIE_ListenServer);
+		PlaySettings->SetPlayNumberOfClients(2);
+		PlaySettings->SetRunUnderOneProcess(true);
+
+		FAutomationEditorCommonUtils::CreateNewMap();
+
+		FRequestPlaySessionParams SessionParams;
+		SessionParams.WorldType = EPlaySessionWorldType::PlayInEditor;
+		GEditor->RequestPlaySession(SessionParams);
+
+		ADD_LATENT_AUTOMATION_COMMAND(FUntilCommand(
+			[Context]()
+			{
+				UWorld* ServerWorld = FindPIEWorld(NM_ListenServer);
+				UWorld* ClientWorld = FindPIEWorld(NM_Client);
+				if (!ServerWorld || !ClientWorld) return false;
+
+				for (FConstPlayerControllerIterator It = ServerWorld->GetPlayerControllerIterator(); It; ++It)
+				{
+					APlayerController* Controller = It->Get();
+					if (Controller && !Controller->IsLocalController())
+					{
+						Context->ServerWorld = ServerWorld;
+						Context->ClientWorld = ClientWorld;
+						Context->RemoteController = Controller;
+						return true;
+					}
+				}
+				return false;
+			},
+			[&Test, Context]()
+			{
+				Test.AddError(TEXT("Listen server and client never connected"));
+				Context->bFailed = true;
+				return true;
+			},
+			SessionTimeout));
+	}
+
+	/** Queued last, so the session ends and the settings come back even after a failed step. */
+	static void AddEndSessionCommands(const TSharedRef<FContext>& Context)
+	{
+		ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([]()
+		{
+			if (GEditor->PlayWorld)
+			{
+				GEditor->RequestEndPlayMap();
+			}
+			return true;
+		}));
+
+		ADD_LATENT_AUTOMATION_COMMAND(FUntilCommand(
+			[]() { return GEditor->PlayWorld == nullptr; },
+			[]() { return true; },
+			SessionTimeout));
+
+		ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([Context]()
+		{
+			ULevelEditorPlaySettings* PlaySettings = GetMutableDefault<ULevelEditorPlaySettings>();
+			PlaySettings->SetPlayNetMode(Context->SavedNetMode);
+			PlaySettings->SetPlayNumberOfClients(Context->SavedNumClients);
+			PlaySettings->SetRunUnderOneProcess(Context->bSavedRunUnderOneProcess);
+			Context->Settings.Reset();
+			return true;
+		}));
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FInteractionListenServerTest, "BDC.Interaction.Network.ListenServer", BDC_INTERACTION_TEST_FLAGS)
+
+bool FInteractionListenServerTest::RunTest(const FString& Parameters)
+{
+	using namespace BDC_InteractionNetworkTest;
+
+	if (!GEditor || GEditor->PlayWorld)
+	{
+		AddError(TEXT("Needs the editor without a running play session"));
+		return false;
+	}
+
+	TSharedRef<FContext> Context = MakeShared<FContext>();
+	Context->Settings = MakeUnique<FInteractionTestSettingsScope>();
+	FInteractionTestSettingsScope& Settings = *Context->Settings;
+	Settings->bAutoUpdateInteractions = false;
+	Settings->bUseAsyncLineOfSight = false;
+	Settings->bCacheLineOfSight = false;
+	Settings->InteractionRange = 200.0f;
+	// One receiver per sliced update, so a sweep over both receivers needs two updates to commit.
+	Settings->bTimeSliceUpdates = true;
+	Settings->TimeSliceReceiverBudget = 1;
+	Settings->TimeSliceMicrosecondBudget = 0.0f;
+
+	StartListenServerSession(*this, Context);
+
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([this, Context]()
+	{
+		UWorld* ServerWorld = Context->ServerWorld.Get();
+		UBDC_InteractionSubsystem* Subsystem = GetSubsystem(ServerWorld);
+		if (Context->bFailed || !Subsystem) return true;
+
+		AActor* InstigatorActor = SpawnReplicatedActor(ServerWorld, Origin, Context->RemoteController.Get());
+		UInteractionInstigatorComponent* InstigatorComp = NewObject<UInteractionInstigatorComponent>(InstigatorActor, TEXT("Instigator"));
+		InstigatorComp->NameOfInteractionComponent = TEXT("Root");
+		InstigatorComp->RegisterComponent();
+
+		AActor* ReceiverActor = SpawnReplicatedActor(ServerWorld, Origin + ReceiverOffset, nullptr);
+		UInteractionReceiverComponent* ReceiverComp = NewObject<UInteractionReceiverComponent>(ReceiverActor, TEXT("Receiver"));
+		ReceiverComp->RegisterComponent();
+
+		// In the field but outside the view cone, so it only costs the sweep a step.
+		AActor* FillerActor = SpawnReplicatedActor(ServerWorld, Origin + FVector(0.0f, 120.0f, 0.0f), nullptr);
+		NewObject<UInteractionReceiverComponent>(FillerActor, TEXT("Receiver"))->RegisterComponent();
+
+		Context->ServerInstigator = InstigatorComp;
+		Context->ServerReceiver = ReceiverComp;
+
+		for (int32 Update = 0; Update < 2; ++Update)
+		{
+			Subsystem->UpdateInteractionsFor(InstigatorComp, Origin, FRotator::ZeroRotator);
+		}
+
+		FInteractionReceivers BestFit;
+		Subsystem->GetCurrentBestFittingOf(InstigatorComp, BestFit);
+		TestTrue(TEXT("Server sees the receiver as best fit"), BestFit.InteractionComponent == ReceiverComp);
+		TestEqual(TEXT("Server field holds both receivers"), Subsystem->GetReceiversInFieldView(InstigatorComp).Num(), 2);
+		return true;
+	}));
+
+	ADD_LATENT_AUTOMATION_COMMAND(FUntilCommand(
+		[Context]()
+		{
+			UWorld* ClientWorld = Context->ClientWorld.Get();
+			if (Context->bFailed || !ClientWorld) return true;
+
+			for (TActorIterator<AActor> It(ClientWorld); It; ++It)
+			{
+				UInteractionInstigatorComponent* InstigatorComp = It->FindComponentByClass<UInteractionInstigatorComponent>();
+				if (!InstigatorComp) continue;
+
+				TArray<UInteractionReceiverComponent*> Field;
+				InstigatorComp->GetReplicatedReceiversInField(Field);
+				if (Field.Num() == 2 && InstigatorComp->GetReplicatedBestFittingReceiver())
+				{
+					Context->ClientInstigator = InstigatorComp;
+					return true;
+				}
+			}
+			return false;
+		},
+		[this, Context]()
+		{
+			AddError(TEXT("Field and best fit never replicated to the owning client"));
+			Context->bFailed = true;
+			return true;
+		},
+		ReplicationTimeout));
+
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([Context]()
+	{
+		if (UInteractionInstigatorComponent* ClientInstigator = Context->ClientInstigator.Get())
+		{
+			ClientInstigator->RequestInteraction();
+		}
+		return true;
+	}));
+
+	ADD_LATENT_AUTOMATION_COMMAND(FUntilCommand(
+		[Context]()
+		{
+			const UBDC_InteractionSubsystem* Subsystem = GetSubsystem(Context->ServerWorld.Get());
+			if (Context->bFailed || !Subsystem) return true;
+
+			FInteractionReceivers LastInteraction;
+			Subsystem->GetLastInteractionOf(Context->ServerInstigator.Get(), LastInteraction);
+			return LastInteraction.InteractionComponent == Context->ServerReceiver.Get();
+		},
+		[this, Context]()
+		{
+			AddError(TEXT("Client request never fired on the server"));
+			Context->bFailed = true;
+			return true;
+		},
+		ReplicationTimeout));
+
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([this, Context]()
+	{
+		UBDC_InteractionSubsystem* Subsystem = GetSubsystem(Context->ServerWorld.Get());
+		UInteractionInstigatorComponent* InstigatorComp = Context->ServerInstigator.Get();
+		UInteractionReceiverComponent* ReceiverComp = Context->ServerReceiver.Get();
+		if (Context->bFailed || !Subsystem || !InstigatorComp || !ReceiverComp) return true;
+
+		// Behind the instigator now, but the committed view still lists it until the next sweep completes.
+		ReceiverComp->GetOwner()->SetActorLocation(Origin - FVector(100.0f, 0.0f, 0.0f));
+		Subsystem->UpdateInteractionsFor(InstigatorComp, Origin, FRotator::ZeroRotator);
+		TestTrue(TEXT("Committed view is stale mid-sweep"), Subsystem->GetReceiversInViewView(InstigatorComp).Contains(ReceiverComp));
+
+		TestFalse(TEXT("Validation rejects a receiver only the stale view contains"), Subsystem->InjectValidatedInteractionFor(InstigatorComp, ReceiverComp));
+		TestFalse(TEXT("Validation committed a complete view"), Subsystem->GetReceiversInViewView(InstigatorComp).Contains(ReceiverComp));
+		return true;
+	}));
+
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([this, Context]()
+	{
+		UWorld* ServerWorld = Context->ServerWorld.Get();
+		UBDC_InteractionSubsystem* Subsystem = GetSubsystem(ServerWorld);
+		UInteractionInstigatorComponent* InstigatorComp = Context->ServerInstigator.Get();
+		UInteractionReceiverComponent* ReceiverComp = Context->ServerReceiver.Get();
+		if (Context->bFailed || !Subsystem || !InstigatorComp || !ReceiverComp) return true;
+
+		// Full updates from here on, so every update commits.
+		(*Context->Settings)->bTimeSliceUpdates = false;
+		ReceiverComp->GetOwner()->SetActorLocation(Origin + ReceiverOffset);
+
+		AActor* CloserActor = SpawnReplicatedActor(ServerWorld, Origin + CloserOffset, nullptr);
+		UInteractionReceiverComponent* CloserComp = NewObject<UInteractionReceiverComponent>(CloserActor, TEXT("Receiver"));
+		CloserComp->RegisterComponent();
+		Context->CloserReceiver = CloserComp;
+
+		Subsystem->UpdateInteractionsFor(InstigatorComp, Origin, FRotator::ZeroRotator);
+
+		FInteractionReceivers BestFit;
+		Subsystem->GetCurrentBestFittingOf(InstigatorComp, BestFit);
+		TestTrue(TEXT("Closer receiver becomes best fit"), BestFit.InteractionComponent == CloserComp);
+		TestTrue(TEXT("Server replicates the closer best fit"), InstigatorComp->GetReplicatedBestFittingReceiver() == CloserComp);
+		return true;
+	}));
+
+	ADD_LATENT_AUTOMATION_COMMAND(FUntilCommand(
+		[Context]() { return Context->bFailed || IsClientBestFitAt(*Context, Origin + CloserOffset); },
+		[this, Context]()
+		{
+			AddError(TEXT("Closer best fit never replicated to the owning client"));
+			Context->bFailed = true;
+			return true;
+		},
+		ReplicationTimeout));
+
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([this, Context]()
+	{
+		UBDC_InteractionSubsystem* Subsystem = GetSubsystem(Context->ServerWorld.Get());
+		UInteractionInstigatorComponent* InstigatorComp = Context->ServerInstigator.Get();
+		UInteractionReceiverComponent* ReceiverComp = Context->ServerReceiver.Get();
+		if (Context->bFailed || !Subsystem || !InstigatorComp || !ReceiverComp) return true;
+
+		Subsystem->CalcNextBestFor(InstigatorComp);
+
+		FInteractionReceivers BestFit;
+		Subsystem->GetCurrentBestFittingOf(InstigatorComp, BestFit);
+		TestTrue(TEXT("Cycling moves the best fit to the next receiver in view"), BestFit.InteractionComponent == ReceiverComp);
+		TestTrue(TEXT("Server replicates the cycled best fit"), InstigatorComp->GetReplicatedBestFittingReceiver() == ReceiverComp);
+		return true;
+	}));
+
+	ADD_LATENT_AUTOMATION_COMMAND(FUntilCommand(
+		[Context]() { return Context->bFailed || IsClientBestFitAt(*Context, Origin + ReceiverOffset); },
+		[this, Context]()
+		{
+			AddError(TEXT("Cycled best fit never replicated to the owning client"));
+			Context->bFailed = true;
+			return true;
+		},
+		ReplicationTimeout));
+
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([this, Context]()
+	{
+		UBDC_InteractionSubsystem* Subsystem = GetSubsystem(Context->ServerWorld.Get());
+		UInteractionInstigatorComponent* InstigatorComp = Context->ServerInstigator.Get();
+		UInteractionReceiverComponent* CloserComp = Context->CloserReceiver.Get();
+		if (Context->bFailed || !Subsystem || !InstigatorComp || !CloserComp) return true;
+
+		Subsystem->CalcPrevBestFor(InstigatorComp);
+		TestTrue(TEXT("Cycling back replicates the closer receiver again"), InstigatorComp->GetReplicatedBestFittingReceiver() == CloserComp);
+		return true;
+	}));
+
+	ADD_LATENT_AUTOMATION_COMMAND(FUntilCommand(
+		[Context]() { return Context->bFailed || IsClientBestFitAt(*Context, Origin + CloserOffset); },
+		[this, Context]()
+		{
+			AddError(TEXT("Best fit cycled back never replicated to the owning client"));
+			Context->bFailed = true;
+			return true;
+		},
+		ReplicationTimeout));
+
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([this, Context]()
+	{
+		UBDC_InteractionSubsystem* Subsystem = GetSubsystem(Context->ServerWorld.Get());
+		UInteractionInstigatorComponent* InstigatorComp = Context->ServerInstigator.Get();
+		UInteractionReceiverComponent* ReceiverComp = Context->ServerReceiver.Get();
+		UInteractionReceiverComponent* CloserComp = Context->CloserReceiver.Get();
+		if (Context->bFailed || !Subsystem || !InstigatorComp || !ReceiverComp || !CloserComp) return true;
+
+		// No update in between: the runner-up has to take over as part of the unregister itself.
+		UInteractionReceiverComponent* const ToRemove[] = { CloserComp };
+		Subsystem->UnregisterReceivers(ToRemove);
+
+		FInteractionReceivers BestFit;
+		Subsystem->GetCurrentBestFittingOf(InstigatorComp, BestFit);
+		TestTrue(TEXT("Runner-up becomes best fit after unregistering the best"), BestFit.InteractionComponent == ReceiverComp);
+		TestTrue(TEXT("Server replicates the runner-up"), InstigatorComp->GetReplicatedBestFittingReceiver() == ReceiverComp);
+		return true;
+	}));
+
+	ADD_LATENT_AUTOMATION_COMMAND(FUntilCommand(
+		[Context]() { return Context->bFailed || IsClientBestFitAt(*Context, Origin + ReceiverOffset); },
+		[this, Context]()
+		{
+			AddError(TEXT("Best fit after unregister never replicated to the owning client"));
+			Context->bFailed = true;
+			return true;
+		},
+		ReplicationTimeout));
+
+	AddEndSessionCommands(Context);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FInteractionAsyncValidationTest, "BDC.Interaction.Network.AsyncLineOfSightValidation", BDC_INTERACTION_TEST_FLAGS)
+
+bool FInteractionAsyncValidationTest::RunTest(const FString& Parameters)
+{
+	using namespace BDC_InteractionNetworkTest;
+
+	if (!GEditor || GEditor->PlayWorld)
+	{
+		AddError(TEXT("Needs the editor without a running play session"));
+		return false;
+	}
+
+	// The dedicated server setup: nothing updates the instigator, so every request is evaluated on arrival.
+	TSharedRef<FContext> Context = MakeShared<FContext>();
+	Context->Settings = MakeUnique<FInteractionTestSettingsScope>();
+	FInteractionTestSettingsScope& Settings = *Context->Settings;
+	Settings->bAutoUpdateInteractions = false;
+	Settings->bUseAsyncLineOfSight = true;
+	Settings->bCacheLineOfSight = false;
+	Settings->bTimeSliceUpdates = false;
+	Settings->InteractionRange = 200.0f;
+
+	StartListenServerSession(*this, Context);
+
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([Context]()
+	{
+		UWorld* ServerWorld = Context->ServerWorld.Get();
+		if (Context->bFailed || !ServerWorld) return true;
+
+		AActor* InstigatorActor = SpawnReplicatedActor(ServerWorld, Origin, Context->RemoteController.Get());
+		UInteractionInstigatorComponent* InstigatorComp = NewObject<UInteractionInstigatorComponent>(InstigatorActor, TEXT("Instigator"));
+		InstigatorComp->NameOfInteractionComponent = TEXT("Root");
+		InstigatorComp->RegisterComponent();
+
+		AActor* ReceiverActor = SpawnReplicatedActor(ServerWorld, Origin + ReceiverOffset, nullptr);
+		UInteractionReceiverComponent* ReceiverComp = NewObject<UInteractionReceiverComponent>(ReceiverActor, TEXT("Receiver"));
+		ReceiverComp->RegisterComponent();
+
+		Context->ServerInstigator = InstigatorComp;
+		Context->ServerReceiver = ReceiverComp;
+		return true;
+	}));
+
+	ADD_LATENT_AUTOMATION_COMMAND(FUntilCommand(
+		[Context]()
+		{
+			UWorld* ClientWorld = Context->ClientWorld.Get();
+			if (Context->bFailed || !ClientWorld) return true;
+
+			for (TActorIterator<AActor> It(ClientWorld); It; ++It)
+			{
+				if (UInteractionInstigatorComponent* InstigatorComp = It->FindComponentByClass<UInteractionInstigatorComponent>())
+				{
+					Context->ClientInstigator = InstigatorComp;
+					return true;
+				}
+			}
+			return false;
+		},
+		[this, Context]()
+		{
+			AddError(TEXT("Instigator never replicated to the owning client"));
+			Context->bFailed = true;
+			return true;
+		},
+		ReplicationTimeout));
+
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([Context]()
+	{
+		if (UInteractionInstigatorComponent* ClientInstigator = Context->ClientInstigator.Get())
+		{
+			ClientInstigator->RequestInteraction();
+		}
+		return true;
+	}));
+
+	ADD_LATENT_AUTOMATION_COMMAND(FUntilCommand(
+		[Context]()
+		{
+			const UBDC_InteractionSubsystem* Subsystem = GetSubsystem(Context->ServerWorld.Get());
+			if (Context->bFailed || !Subsystem) return true;
+
+			FInteractionReceivers LastInteraction;
+			Subsystem->GetLastInteractionOf(Context->ServerInstigator.Get(), LastInteraction);
+			return LastInteraction.InteractionComponent == Context->ServerReceiver.Get();
+		},
+		[this, Context]()
+		{
+			AddError(TEXT("First request was rejected while its async traces were still in flight"));
+			Context->bFailed = true;
+			return true;
+		},
+		ReplicationTimeout));
+
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([this, Context]()
+	{
+		UBDC_InteractionSubsystem* Subsystem = GetSubsystem(Context->ServerWorld.Get());
+		UInteractionInstigatorComponent* InstigatorComp = Context->ServerInstigator.Get();
+		UInteractionReceiverComponent* ReceiverComp = Context->ServerReceiver.Get();
+		if (Context->bFailed || !Subsystem || !InstigatorComp || !ReceiverComp) return true;
+
+		// The regular update right after a validation must not lose what the validation just saw.
+		const TArray<UInteractionReceiverComponent*> FieldAfterRequest(Subsystem->GetReceiversInFieldView(InstigatorComp));
+		TestTrue(TEXT("Validation put the receiver in the field"), FieldAfterRequest.Contains(ReceiverComp));
+
+		Subsystem->UpdateInteractionsFor(InstigatorComp, Origin, FRotator::ZeroRotator);
+		TestTrue(TEXT("Field is unchanged by the next regular update"), TArray<UInteractionReceiverComponent*>(Subsystem->GetReceiversInFieldView(InstigatorComp)) == FieldAfterRequest);
+		return true;
+	}));
+
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([this, Context]()
+	{
+		UWorld* ServerWorld = Context->ServerWorld.Get();
+		UBDC_InteractionSubsystem* Subsystem = GetSubsystem(ServerWorld);
+		UInteractionInstigatorComponent* InstigatorComp = Context->ServerInstigator.Get();
+		UInteractionReceiverComponent* ReceiverComp = Context->ServerReceiver.Get();
+		if (Context->bFailed || !Subsystem || !InstigatorComp || !ReceiverComp) return true;
+
+		// The door closes after the last request; the async results from that request still read it as open.
+		AActor* WallActor = SpawnReplicatedActor(ServerWorld, Origin + ReceiverOffset * 0.5f, nullptr);
+		UBoxComponent* Wall = NewObject<UBoxComponent>(WallActor, TEXT("Wall"));
+		Wall->SetBoxExtent(FVector(10.0f, 100.0f, 100.0f));
+		Wall->SetCollisionProfileName(UCollisionProfile::BlockAll_ProfileName);
+		Wall->SetupAttachment(WallActor->GetRootComponent());
+		Wall->RegisterComponent();
+
+		TestFalse(TEXT("Validation traces through the closed door"), Subsystem->InjectValidatedInteractionFor(InstigatorComp, ReceiverComp));
+		return true;
+	}));
+
+	AddEndSessionCommands(Context);
+	return true;
+}
+
+#endif
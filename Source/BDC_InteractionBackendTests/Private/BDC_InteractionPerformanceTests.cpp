@@ -0,0 +1,293 @@
+/* Copyright © beginning at 2026 - BlackDevilCreations
+ * Author: Patrick Wenzel
+ * All rights reserved.
+ * This file is part of a BlackDevilCreations project and may not be distributed, copied,
+ * or modified without prior written permission from BlackDevilCreations.
+ * Unreal Engine and its associated trademarks are property of Epic Games, Inc.
+ * and are used with permission.
+ */
+#include "BDC_InteractionTestFlags.h"
+#include "BDC_InteractionTestWorld.h"
+#include "BDC_InteractionBenchmark.h"
+#include "BDC_InteractionSettings.h"
+#include "BDC_InteractionSubsystem.h"
+#include "Components/InteractionInstigator.h"
+#include "Components/InteractionReceiver.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/Parse.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// Only relative checks, since absolute timings depend on the machine and the build. The timings themselves go to the
+// test log, the analytics items and the same CSV the BDC.Interaction.Benchmark command writes.
+namespace BDC_InteractionPerformanceTest
+{
+	/** Update cost at four times the receivers and the same density. Grid queries stay local, a pass over every receiver would be 4x. */
+	constexpr double MaxUpdateScaling = 2.0;
+	/** A sliced step against a full update of the same field. */
+	constexpr double MaxSlicedStepRatio = 1.25;
+	/** A validated inject re-evaluates in full, so on top of an update it may only add the broadcast. */
+	constexpr double MaxValidatedInjectRatio = 1.25;
+	/** Unregistering four times the receivers. Linear is 4x, a quadratic bucket removal 16x. */
+	constexpr double MaxUnregisterScaling = 8.0;
+
+	constexpr float ReceiverSpacing = 100.0f;
+	constexpr float InteractionRange = 500.0f;
+	constexpr float PathRadius = 250.0f;
+	constexpr int32 SliceReceiverBudget = 16;
+	/** Spawn and unregister rounds per size, so one GC pass or scheduler hitch cannot decide the scaling check. */
+	constexpr int32 UnregisterRounds = 5;
+
+	struct FConfig
+	{
+		int32 Receivers = 10000;
+		/** Occluders per receiver, spread over the same area. */
+		float OccluderDensity = 0.0f;
+		int32 Iterations = 100;
+		FString OutputPath;
+	};
+
+	static FConfig ParseConfig(const FString& Parameters)
+	{
+		FConfig Config;
+		FParse::Value(*Parameters, TEXT("Receivers="), Config.Receivers);
+		FParse::Value(*Parameters, TEXT("OccluderDensity="), Config.OccluderDensity);
+		FParse::Value(*Parameters, TEXT("Iterations="), Config.Iterations);
+		FParse::Value(*Parameters, TEXT("Out="), Config.OutputPath);
+
+		Config.Receivers = FMath::Clamp(Config.Receivers, 4, 1000000);
+		Config.OccluderDensity = FMath::Clamp(Config.OccluderDensity, 0.0f, 1.0f);
+		Config.Iterations = FMath::Max(1, Config.Iterations);
+		return Config;
+	}
+
+	/** Half the side of the square that holds NumReceivers at ReceiverSpacing. */
+	static float GetExtent(int32 NumReceivers)
+	{
+		return ReceiverSpacing * FMath::Sqrt(static_cast<float>(NumReceivers)) * 0.5f;
+	}
+
+	static FVector GetRandomLocation(FRandomStream& Random, float InnerExtent, float OuterExtent)
+	{
+		FVector Location;
+		do
+		{
+			Location = FVector(Random.FRandRange(-OuterExtent, OuterExtent), Random.FRandRange(-OuterExtent, OuterExtent), 0.0f);
+		}
+		while (FMath::Abs(Location.X) < InnerExtent && FMath::Abs(Location.Y) < InnerExtent);
+		return Location;
+	}
+
+	static double GetMedianMicroseconds(const FInteractionBenchmarkResult& Result)
+	{
+		TArray<double> Sorted = Result.SampleMicroseconds;
+		Sorted.Sort();
+		return Sorted.Num() > 0 ? Sorted[Sorted.Num() / 2] : 0.0;
+	}
+
+	/** Circles the instigator around the origin, well inside the receivers, and times every update. */
+	static void MeasureUpdates(FInteractionTestWorld& TestWorld, UInteractionInstigatorComponent* InstigatorComp, int32 Iterations,
+		FInteractionBenchmarkResult& OutUpdate, FInteractionBenchmarkResult* OutInject = nullptr)
+	{
+		UBDC_InteractionSubsystem* Subsystem = TestWorld.GetSubsystem();
+		for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+		{
+			const float Angle = 2.0f * PI * Iteration / Iterations;
+			const FVector Location(FMath::Cos(Angle) * PathRadius, FMath::Sin(Angle) * PathRadius, 0.0f);
+			const FRotator Rotation(0.0f, FMath::RadiansToDegrees(Angle) + 90.0f, 0.0f);
+
+			// Every sample follows a world tick, so updates and validations are timed under the same cache conditions.
+			InstigatorComp->GetOwner()->SetActorLocationAndRotation(Location, Rotation);
+			TestWorld.Tick(1.0f / 60.0f);
+
+			double StartTime = FPlatformTime::Seconds();
+			Subsystem->UpdateInteractionsFor(InstigatorComp, Location, Rotation);
+			OutUpdate.SampleMicroseconds.Add((FPlatformTime::Seconds() - StartTime) * 1000000.0);
+
+			if (OutInject)
+			{
+				// Validation reuses an update from the same world time, so the world advances again to make it evaluate.
+				TestWorld.Tick(1.0f / 60.0f);
+
+				StartTime = FPlatformTime::Seconds();
+				Subsystem->InjectValidatedInteractionFor(InstigatorComp, nullptr);
+				OutInject->SampleMicroseconds.Add((FPlatformTime::Seconds() - StartTime) * 1000000.0);
+			}
+		}
+	}
+
+	static void Record(FAutomationTestBase& Test, const FInteractionBenchmarkResult& Result)
+	{
+		const double MedianMicroseconds = GetMedianMicroseconds(Result);
+		Test.AddInfo(FString::Printf(TEXT("%s: %d receivers, median %.2f us, average %.2f us, max %.2f us"),
+			*Result.Operation, Result.Receivers, MedianMicroseconds, Result.GetAverageMicroseconds(), Result.GetMaxMicroseconds()));
+		Test.AddAnalyticsItem(FString::Printf(TEXT("%s_%d_MedianUs=%.2f"), *Result.Operation, Result.Receivers, MedianMicroseconds));
+	}
+}
+
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(FInteractionUpdateScalingTest, "BDC.Interaction.Performance.UpdateScaling", BDC_INTERACTION_PERF_TEST_FLAGS)
+
+void FInteractionUpdateScalingTest::GetTests(TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands) const
+{
+	for (const int32 NumReceivers : { 100, 1000, 10000, 50000 })
+	{
+		for (const float OccluderDensity : { 0.0f, 0.05f })
+		{
+			OutBeautifiedNames.Add(FString::Printf(TEXT("Receivers%d%s"), NumReceivers, OccluderDensity > 0.0f ? TEXT("_Occluded") : TEXT("")));
+			OutTestCommands.Add(FString::Printf(TEXT("Receivers=%d OccluderDensity=%.2f"), NumReceivers, OccluderDensity));
+		}
+	}
+}
+
+bool FInteractionUpdateScalingTest::RunTest(const FString& Parameters)
+{
+	using namespace BDC_InteractionPerformanceTest;
+
+	const FConfig Config = ParseConfig(Parameters);
+
+	FInteractionTestSettingsScope Settings;
+	Settings->bAutoUpdateInteractions = false;
+	Settings->bTimeSliceUpdates = false;
+	Settings->bUseAsyncLineOfSight = false;
+	Settings->bCacheLineOfSight = false;
+	Settings->bUseCoarseOcclusion = Config.OccluderDensity > 0.0f;
+	Settings->InteractionRange = InteractionRange;
+	Settings->TimeSliceReceiverBudget = SliceReceiverBudget;
+	Settings->TimeSliceMicrosecondBudget = 0.0f;
+	Settings->MaxInteractionRequestsPerSecond = 0;
+
+	FInteractionTestWorld TestWorld;
+	if (!TestTrue(TEXT("Test world created"), TestWorld.IsValid())) return false;
+
+	// A quarter of the receivers fills the inner square for the baseline, the rest the ring around it at the same density.
+	const int32 NumBaseline = Config.Receivers / 4;
+	const float BaselineExtent = GetExtent(NumBaseline);
+	const float FullExtent = BaselineExtent * 2.0f;
+	FRandomStream Random(0x8DC);
+
+	const int32 NumOccluders = FMath::RoundToInt(Config.Receivers * Config.OccluderDensity);
+	for (int32 Index = 0; Index < NumOccluders; ++Index)
+	{
+		const FVector Extent(Random.FRandRange(25.0f, 100.0f), Random.FRandRange(25.0f, 100.0f), 200.0f);
+		TestWorld.SpawnOccluder(GetRandomLocation(Random, 0.0f, FullExtent), Extent, true);
+	}
+
+	for (int32 Index = 0; Index < NumBaseline; ++Index)
+	{
+		TestWorld.SpawnReceiver(GetRandomLocation(Random, 0.0f, BaselineExtent));
+	}
+
+	UInteractionInstigatorComponent* InstigatorComp = TestWorld.SpawnInstigator(FVector::ZeroVector);
+
+	FInteractionBenchmarkResult BaselineUpdate{ TEXT("UpdateInteractions"), NumBaseline };
+	MeasureUpdates(TestWorld, InstigatorComp, Config.Iterations, BaselineUpdate);
+
+	for (int32 Index = NumBaseline; Index < Config.Receivers; ++Index)
+	{
+		TestWorld.SpawnReceiver(GetRandomLocation(Random, BaselineExtent, FullExtent));
+	}
+
+	FInteractionBenchmarkResult Update{ TEXT("UpdateInteractions"), Config.Receivers };
+	FInteractionBenchmarkResult Inject{ TEXT("InjectValidatedInteraction"), Config.Receivers };
+	MeasureUpdates(TestWorld, InstigatorComp, Config.Iterations, Update, &Inject);
+
+	Settings->bTimeSliceUpdates = true;
+	FInteractionBenchmarkResult SlicedUpdate{ TEXT("UpdateInteractionsSliced"), Config.Receivers };
+	MeasureUpdates(TestWorld, InstigatorComp, Config.Iterations, SlicedUpdate);
+
+	const TArray<FInteractionBenchmarkResult> Results = { BaselineUpdate, Update, Inject, SlicedUpdate };
+	for (const FInteractionBenchmarkResult& Result : Results)
+	{
+		Record(*this, Result);
+	}
+
+	const double BaselineMedian = GetMedianMicroseconds(BaselineUpdate);
+	const double UpdateMedian = GetMedianMicroseconds(Update);
+
+	// Until the baseline square covers the whole path plus range, its field still grows with the receiver count.
+	if (BaselineExtent >= InteractionRange + PathRadius)
+	{
+		TestTrue(FString::Printf(TEXT("Update at %d receivers within %.1fx of %d at the same density"), Config.Receivers, MaxUpdateScaling, NumBaseline),
+			UpdateMedian <= BaselineMedian * MaxUpdateScaling);
+	}
+	else
+	{
+		AddInfo(FString::Printf(TEXT("Scaling not checked, %d receivers do not fill the field"), NumBaseline));
+	}
+	TestTrue(FString::Printf(TEXT("Sliced step within %.2fx of a full update"), MaxSlicedStepRatio), GetMedianMicroseconds(SlicedUpdate) <= UpdateMedian * MaxSlicedStepRatio);
+	TestTrue(FString::Printf(TEXT("Validated inject within %.2fx of an update"), MaxValidatedInjectRatio), GetMedianMicroseconds(Inject) <= UpdateMedian * MaxValidatedInjectRatio);
+
+	const FString OutputPath = FInteractionBenchmarkReport::Save(Results, Config.Receivers, Config.OutputPath);
+	if (!OutputPath.IsEmpty())
+	{
+		AddInfo(FString::Printf(TEXT("Wrote results to %s"), *OutputPath));
+	}
+	else
+	{
+		AddWarning(TEXT("Could not write the results CSV"));
+	}
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FInteractionBulkUnregisterTest, "BDC.Interaction.Performance.BulkUnregister", BDC_INTERACTION_PERF_TEST_FLAGS)
+
+bool FInteractionBulkUnregisterTest::RunTest(const FString& Parameters)
+{
+	using namespace BDC_InteractionPerformanceTest;
+
+	FInteractionTestSettingsScope Settings;
+	Settings->bAutoUpdateInteractions = false;
+
+	FInteractionTestWorld TestWorld;
+	if (!TestTrue(TEXT("Test world created"), TestWorld.IsValid())) return false;
+
+	UBDC_InteractionSubsystem* Subsystem = TestWorld.GetSubsystem();
+	TArray<FInteractionReceivers> Found;
+
+	// Every receiver keeps the default name and an empty tag, so they all share one lookup bucket per key.
+	auto MeasureUnregister = [&](int32 NumReceivers) -> FInteractionBenchmarkResult
+	{
+		FInteractionBenchmarkResult Result{ TEXT("UnregisterReceivers"), NumReceivers };
+		TArray<UInteractionReceiverComponent*> Receivers;
+		Receivers.Reserve(NumReceivers);
+
+		for (int32 Round = 0; Round < UnregisterRounds; ++Round)
+		{
+			Receivers.Reset();
+			for (int32 Index = 0; Index < NumReceivers; ++Index)
+			{
+				Receivers.Add(TestWorld.SpawnReceiver(FVector((Index % 200) * 100.0f, (Index / 200) * 100.0f, 0.0f)));
+			}
+
+			const FName SharedName = Receivers[0]->NameOfReceiver;
+			Subsystem->GetReceiversByName(SharedName, Found);
+			TestEqual(TEXT("All receivers share the name bucket"), Found.Num(), NumReceivers);
+
+			const double StartTime = FPlatformTime::Seconds();
+			Subsystem->UnregisterReceivers(Receivers);
+			Result.SampleMicroseconds.Add((FPlatformTime::Seconds() - StartTime) * 1000000.0);
+
+			Subsystem->GetReceiversByName(SharedName, Found);
+			TestEqual(TEXT("Name bucket emptied"), Found.Num(), 0);
+
+			// Each round spawns a fresh set, so the previous one goes before it piles up in the test world.
+			for (UInteractionReceiverComponent* Receiver : Receivers)
+			{
+				Receiver->GetOwner()->Destroy();
+			}
+		}
+
+		Record(*this, Result);
+		return Result;
+	};
+
+	constexpr int32 NumReceivers = 20000;
+	const FInteractionBenchmarkResult Quarter = MeasureUnregister(NumReceivers / 4);
+	const FInteractionBenchmarkResult Full = MeasureUnregister(NumReceivers);
+
+	TestTrue(FString::Printf(TEXT("Unregistering 4x the receivers within %.0fx the time"), MaxUnregisterScaling),
+		GetMedianMicroseconds(Full) <= GetMedianMicroseconds(Quarter) * MaxUnregisterScaling);
+	return true;
+}
+
+#endif
@@ -0,0 +1,351 @@
+/* Copyright © beginning at 2026 - BlackDevilCreations
+ * Author: Patrick Wenzel
+ * All rights reserved.
+ * This file is part of a BlackDevilCreations project and may not be distributed, copied,
+ * or modified without prior written permission from BlackDevilCreations.
+ * Unreal Engine and its associated trademarks are property of Epic Games, Inc.
+ * and are used with permission.
+ */
+#include "BDC_InteractionTestFlags.h"
+#include "BDC_InteractionTestWorld.h"
+#include "BDC_InteractionSettings.h"
+#include "BDC_InteractionSubsystem.h"
+#include "Components/InteractionInstigator.h"
+#include "Components/InteractionOccluder.h"
+#include "Components/InteractionReceiver.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FInteractionFieldRangeAndViewTest, "BDC.Interaction.Field.RangeAndView", BDC_INTERACTION_TEST_FLAGS)
+
+bool FInteractionFieldRangeAndViewTest::RunTest(const FString& Parameters)
+{
+	FInteractionTestSettingsScope Settings;
+	Settings->bAutoUpdateInteractions = false;
+	Settings->InteractionRange = 200.0f;
+
+	FInteractionTestWorld TestWorld;
+	if (!TestTrue(TEXT("Test world created"), TestWorld.IsValid())) return false;
+
+	UInteractionInstigatorComponent* InstigatorComp = TestWorld.SpawnInstigator(FVector::ZeroVector);
+	UInteractionReceiverComponent* Ahead = TestWorld.SpawnReceiver(FVector(150.0f, 0.0f, 0.0f));
+	UInteractionReceiverComponent* Behind = TestWorld.SpawnReceiver(FVector(-150.0f, 0.0f, 0.0f));
+	UInteractionReceiverComponent* Far = TestWorld.SpawnReceiver(FVector(1000.0f, 0.0f, 0.0f));
+
+	UBDC_InteractionSubsystem* Subsystem = TestWorld.GetSubsystem();
+	Subsystem->UpdateInteractionsFor(InstigatorComp, FVector::ZeroVector, FRotator::ZeroRotator);
+
+	const TConstArrayView<UInteractionReceiverComponent*> Field = Subsystem->GetReceiversInFieldView(InstigatorComp);
+	const TConstArrayView<UInteractionReceiverComponent*> View = Subsystem->GetReceiversInViewView(InstigatorComp);
+	TestTrue(TEXT("Receiver ahead is in the field"), Field.Contains(Ahead));
+	TestTrue(TEXT("Receiver behind is in the field"), Field.Contains(Behind));
+	TestFalse(TEXT("Receiver out of range is not in the field"), Field.Contains(Far));
+	TestTrue(TEXT("Receiver ahead is in view"), View.Contains(Ahead));
+	TestFalse(TEXT("Receiver behind is not in view"), View.Contains(Behind));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FInteractionFieldFarFromOriginTest, "BDC.Interaction.Field.FarFromOrigin", BDC_INTERACTION_TEST_FLAGS)
+
+bool FInteractionFieldFarFromOriginTest::RunTest(const FString& Parameters)
+{
+	FInteractionTestSettingsScope Settings;
+	Settings->bAutoUpdateInteractions = false;
+	Settings->InteractionRange = 200.0f;
+
+	FInteractionTestWorld TestWorld;
+	if (!TestTrue(TEXT("Test world created"), TestWorld.IsValid())) return false;
+
+	// A float has an 8 unit step out here, so one unit either side of the range edge only resolves in double.
+	const FVector Origin(100000003.0, -100000005.0, 0.0);
+	const double Reach = Settings->InteractionRange + GetDefault<UInteractionReceiverComponent>()->ReceiverRadius;
+
+	UInteractionInstigatorComponent* InstigatorComp = TestWorld.SpawnInstigator(Origin);
+	UInteractionReceiverComponent* Inside = TestWorld.SpawnReceiver(Origin + FVector(Reach - 1.0, 0.0, 0.0));
+	UInteractionReceiverComponent* Outside = TestWorld.SpawnReceiver(Origin + FVector(Reach + 1.0, 0.0, 0.0));
+
+	UBDC_InteractionSubsystem* Subsystem = TestWorld.GetSubsystem();
+	Subsystem->UpdateInteractionsFor(InstigatorComp, Origin, FRotator::ZeroRotator);
+
+	const TConstArrayView<UInteractionReceiverComponent*> Field = Subsystem->GetReceiversInFieldView(InstigatorComp);
+	TestTrue(TEXT("Receiver just inside the range is in the field"), Field.Contains(Inside));
+	TestFalse(TEXT("Receiver just outside the range is not in the field"), Field.Contains(Outside));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FInteractionBestFitNearestTest, "BDC.Interaction.BestFit.Nearest", BDC_INTERACTION_TEST_FLAGS)
+
+bool FInteractionBestFitNearestTest::RunTest(const FString& Parameters)
+{
+	FInteractionTestSettingsScope Settings;
+	Settings->bAutoUpdateInteractions = false;
+	Settings->bUseWeightedScoring = false;
+	Settings->InteractionRange = 500.0f;
+
+	FInteractionTestWorld TestWorld;
+	if (!TestTrue(TEXT("Test world created"), TestWorld.IsValid())) return false;
+
+	UInteractionInstigatorComponent* InstigatorComp = TestWorld.SpawnInstigator(FVector::ZeroVector);
+	UInteractionReceiverComponent* Farther = TestWorld.SpawnReceiver(FVector(300.0f, 0.0f, 0.0f));
+	UInteractionReceiverComponent* Nearer = TestWorld.SpawnReceiver(FVector(100.0f, 0.0f, 0.0f));
+
+	UBDC_InteractionSubsystem* Subsystem = TestWorld.GetSubsystem();
+	Subsystem->UpdateInteractionsFor(InstigatorComp, FVector::ZeroVector, FRotator::ZeroRotator);
+
+	FInteractionReceivers BestFit;
+	Subsystem->GetCurrentBestFittingOf(InstigatorComp, BestFit);
+	TestTrue(TEXT("Nearest receiver is the best fit"), BestFit.InteractionComponent == Nearer);
+
+	Subsystem->CalcNextBestFor(InstigatorComp);
+	Subsystem->GetCurrentBestFittingOf(InstigatorComp, BestFit);
+	TestTrue(TEXT("Cycling moves to the next receiver in view"), BestFit.InteractionComponent == Farther);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FInteractionBestFitHysteresisTest, "BDC.Interaction.BestFit.Hysteresis", BDC_INTERACTION_TEST_FLAGS)
+
+bool FInteractionBestFitHysteresisTest::RunTest(const FString& Parameters)
+{
+	FInteractionTestSettingsScope Settings;
+	Settings->bAutoUpdateInteractions = false;
+	Settings->bUseWeightedScoring = false;
+	Settings->InteractionRange = 500.0f;
+	Settings->BestFitHysteresis = 50.0f;
+
+	FInteractionTestWorld TestWorld;
+	if (!TestTrue(TEXT("Test world created"), TestWorld.IsValid())) return false;
+
+	UInteractionInstigatorComponent* InstigatorComp = TestWorld.SpawnInstigator(FVector::ZeroVector);
+	UInteractionReceiverComponent* Holder = TestWorld.SpawnReceiver(FVector(100.0f, 0.0f, 0.0f));
+	UInteractionReceiverComponent* Rival = TestWorld.SpawnReceiver(FVector(130.0f, 5.0f, 0.0f));
+
+	UBDC_InteractionSubsystem* Subsystem = TestWorld.GetSubsystem();
+	auto UpdateAndGetBest = [&]()
+	{
+		Subsystem->UpdateInteractionsFor(InstigatorComp, FVector::ZeroVector, FRotator::ZeroRotator);
+		FInteractionReceivers BestFit;
+		Subsystem->GetCurrentBestFittingOf(InstigatorComp, BestFit);
+		return BestFit.InteractionComponent;
+	};
+
+	TestTrue(TEXT("Nearest receiver starts as best fit"), UpdateAndGetBest() == Holder);
+
+	// The rival overtakes by 20 units, then pulls ahead to 40 and 70 without the order of the view changing again.
+	Rival->GetOwner()->SetActorLocation(FVector(80.0f, 5.0f, 0.0f));
+	TestTrue(TEXT("A lead inside the margin keeps the best fit"), UpdateAndGetBest() == Holder);
+
+	Rival->GetOwner()->SetActorLocation(FVector(60.0f, 5.0f, 0.0f));
+	TestTrue(TEXT("A growing lead still inside the margin keeps the best fit"), UpdateAndGetBest() == Holder);
+
+	Rival->GetOwner()->SetActorLocation(FVector(30.0f, 5.0f, 0.0f));
+	TestTrue(TEXT("A lead past the margin takes over without a reorder"), UpdateAndGetBest() == Rival);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FInteractionRotatedBoxTest, "BDC.Interaction.Shape.RotatedBox", BDC_INTERACTION_TEST_FLAGS)
+
+bool FInteractionRotatedBoxTest::RunTest(const FString& Parameters)
+{
+	FInteractionTestSettingsScope Settings;
+	Settings->bAutoUpdateInteractions = false;
+	Settings->InteractionRange = 150.0f;
+
+	FInteractionTestWorld TestWorld;
+	if (!TestTrue(TEXT("Test world created"), TestWorld.IsValid())) return false;
+
+	UInteractionInstigatorComponent* InstigatorComp = TestWorld.SpawnInstigator(FVector::ZeroVector);
+	UInteractionReceiverComponent* Plank = TestWorld.SpawnReceiver(FVector(250.0f, 0.0f, 0.0f));
+	Plank->SetInteractionShape(EInteractionReceiverShape::Box, 0.0f, FVector(200.0f, 10.0f, 50.0f), 0.0f);
+
+	UBDC_InteractionSubsystem* Subsystem = TestWorld.GetSubsystem();
+	Subsystem->UpdateInteractionsFor(InstigatorComp, FVector::ZeroVector, FRotator::ZeroRotator);
+	TestTrue(TEXT("Plank pointing at the instigator is in the field"), Subsystem->GetReceiversInFieldView(InstigatorComp).Contains(Plank));
+
+	// Turned by 45 degrees its AABB still starts about 100 units away, the plank itself is about 167 units away.
+	Plank->GetOwner()->SetActorRotation(FRotator(0.0f, 45.0f, 0.0f));
+	Subsystem->UpdateInteractionsFor(InstigatorComp, FVector::ZeroVector, FRotator::ZeroRotator);
+	TestFalse(TEXT("Turned plank is measured by its own faces, not its AABB"), Subsystem->GetReceiversInFieldView(InstigatorComp).Contains(Plank));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FInteractionLargeReachTest, "BDC.Interaction.Shape.LargeReach", BDC_INTERACTION_TEST_FLAGS)
+
+bool FInteractionLargeReachTest::RunTest(const FString& Parameters)
+{
+	FInteractionTestSettingsScope Settings;
+	Settings->bAutoUpdateInteractions = false;
+	Settings->InteractionRange = 200.0f;
+
+	FInteractionTestWorld TestWorld;
+	if (!TestTrue(TEXT("Test world created"), TestWorld.IsValid())) return false;
+
+	UInteractionInstigatorComponent* InstigatorComp = TestWorld.SpawnInstigator(FVector::ZeroVector);
+	UInteractionReceiverComponent* Beacon = TestWorld.SpawnReceiver(FVector(3000.0f, 0.0f, 0.0f));
+	UInteractionReceiverComponent* Crate = TestWorld.SpawnReceiver(FVector(3000.0f, 100.0f, 0.0f));
+	Beacon->SetInteractionRangeOverride(5000.0f);
+
+	UBDC_InteractionSubsystem* Subsystem = TestWorld.GetSubsystem();
+	Subsystem->UpdateInteractionsFor(InstigatorComp, FVector::ZeroVector, FRotator::ZeroRotator);
+	TestTrue(TEXT("Long-range receiver is found far outside the grid query"), Subsystem->GetReceiversInFieldView(InstigatorComp).Contains(Beacon));
+	TestFalse(TEXT("Its neighbour keeps the global range"), Subsystem->GetReceiversInFieldView(InstigatorComp).Contains(Crate));
+
+	Beacon->SetInteractionRangeOverride(0.0f);
+	Subsystem->UpdateInteractionsFor(InstigatorComp, FVector::ZeroVector, FRotator::ZeroRotator);
+	TestFalse(TEXT("Dropping the override puts it back on the global range"), Subsystem->GetReceiversInFieldView(InstigatorComp).Contains(Beacon));
+
+	// A wider global range reclassifies every receiver against the new query radius.
+	Settings->InteractionRange = 4000.0f;
+	Subsystem->UpdateInteractionsFor(InstigatorComp, FVector::ZeroVector, FRotator::ZeroRotator);
+	TestTrue(TEXT("Wider global range reaches the neighbour"), Subsystem->GetReceiversInFieldView(InstigatorComp).Contains(Crate));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FInteractionOccluderExtentTest, "BDC.Interaction.Occlusion.ExtentChange", BDC_INTERACTION_TEST_FLAGS)
+
+bool FInteractionOccluderExtentTest::RunTest(const FString& Parameters)
+{
+	FInteractionTestSettingsScope Settings;
+	Settings->bAutoUpdateInteractions = false;
+	Settings->bUseAsyncLineOfSight = false;
+	Settings->bCacheLineOfSight = false;
+	Settings->bUseCoarseOcclusion = true;
+	Settings->InteractionRange = 200.0f;
+
+	FInteractionTestWorld TestWorld;
+	if (!TestTrue(TEXT("Test world created"), TestWorld.IsValid())) return false;
+
+	// Without collision only the coarse stage can hide the receiver, so it has to see the new extent.
+	UInteractionInstigatorComponent* InstigatorComp = TestWorld.SpawnInstigator(FVector::ZeroVector);
+	UInteractionReceiverComponent* Receiver = TestWorld.SpawnReceiver(FVector(150.0f, 0.0f, 0.0f));
+	UInteractionOccluderComponent* Occluder = TestWorld.SpawnOccluder(FVector(75.0f, 150.0f, 0.0f), FVector(10.0f, 50.0f, 100.0f), false);
+
+	UBDC_InteractionSubsystem* Subsystem = TestWorld.GetSubsystem();
+	Subsystem->UpdateInteractionsFor(InstigatorComp, FVector::ZeroVector, FRotator::ZeroRotator);
+	TestTrue(TEXT("Occluder beside the line leaves the receiver in the field"), Subsystem->GetReceiversInFieldView(InstigatorComp).Contains(Receiver));
+
+	Occluder->SetBoxExtent(FVector(10.0f, 200.0f, 100.0f));
+	Subsystem->UpdateInteractionsFor(InstigatorComp, FVector::ZeroVector, FRotator::ZeroRotator);
+	TestFalse(TEXT("Grown occluder hides the receiver"), Subsystem->GetReceiversInFieldView(InstigatorComp).Contains(Receiver));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FInteractionTimeSliceMatchesFullUpdateTest, "BDC.Interaction.TimeSlice.MatchesFullUpdate", BDC_INTERACTION_TEST_FLAGS)
+
+bool FInteractionTimeSliceMatchesFullUpdateTest::RunTest(const FString& Parameters)
+{
+	FInteractionTestSettingsScope Settings;
+	Settings->bAutoUpdateInteractions = false;
+	Settings->InteractionRange = 2000.0f;
+	Settings->TimeSliceReceiverBudget = 16;
+	Settings->TimeSliceMicrosecondBudget = 0.0f;
+
+	FInteractionTestWorld TestWorld;
+	if (!TestTrue(TEXT("Test world created"), TestWorld.IsValid())) return false;
+
+	FRandomStream Random(0x8DC);
+	constexpr int32 NumReceivers = 200;
+	for (int32 Index = 0; Index < NumReceivers; ++Index)
+	{
+		TestWorld.SpawnReceiver(FVector(Random.FRandRange(-1500.0f, 1500.0f), Random.FRandRange(-1500.0f, 1500.0f), 0.0f));
+	}
+
+	UInteractionInstigatorComponent* FullInstigator = TestWorld.SpawnInstigator(FVector::ZeroVector);
+	UInteractionInstigatorComponent* SlicedInstigator = TestWorld.SpawnInstigator(FVector::ZeroVector);
+	UBDC_InteractionSubsystem* Subsystem = TestWorld.GetSubsystem();
+
+	Settings->bTimeSliceUpdates = false;
+	Subsystem->UpdateInteractionsFor(FullInstigator, FVector::ZeroVector, FRotator::ZeroRotator);
+
+	Settings->bTimeSliceUpdates = true;
+	for (int32 Slice = 0; Slice <= NumReceivers / Settings->TimeSliceReceiverBudget + 1; ++Slice)
+	{
+		Subsystem->UpdateInteractionsFor(SlicedInstigator, FVector::ZeroVector, FRotator::ZeroRotator);
+	}
+
+	TArray<UInteractionReceiverComponent*> FullField(Subsystem->GetReceiversInFieldView(FullInstigator));
+	TArray<UInteractionReceiverComponent*> SlicedField(Subsystem->GetReceiversInFieldView(SlicedInstigator));
+	FullField.Sort();
+	SlicedField.Sort();
+	TestTrue(TEXT("Field is not empty"), FullField.Num() > 0);
+	TestTrue(TEXT("A completed sweep yields the same field as a full update"), FullField == SlicedField);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FInteractionAsyncLineOfSightThrottledTest, "BDC.Interaction.LineOfSight.AsyncThrottled", BDC_INTERACTION_TEST_FLAGS)
+
+bool FInteractionAsyncLineOfSightThrottledTest::RunTest(const FString& Parameters)
+{
+	// Once a visible receiver entered the field it has to stay, however many frames lie between two updates or sweeps.
+	for (const bool bTimeSliced : { false, true })
+	{
+		FInteractionTestSettingsScope Settings;
+		Settings->bAutoUpdateInteractions = true;
+		Settings->ActiveUpdateInterval = 0.25f;
+		Settings->IdleUpdateInterval = 0.25f;
+		Settings->bUseAsyncLineOfSight = true;
+		Settings->bCacheLineOfSight = false;
+		Settings->InteractionRange = 500.0f;
+		Settings->bTimeSliceUpdates = bTimeSliced;
+		Settings->TimeSliceReceiverBudget = 8;
+		Settings->TimeSliceMicrosecondBudget = 0.0f;
+
+		FInteractionTestWorld TestWorld;
+		if (!TestTrue(TEXT("Test world created"), TestWorld.IsValid())) return false;
+
+		UInteractionInstigatorComponent* InstigatorComp = TestWorld.SpawnInstigator(FVector::ZeroVector);
+		UInteractionReceiverComponent* Target = TestWorld.SpawnReceiver(FVector(150.0f, 0.0f, 0.0f));
+		if (bTimeSliced)
+		{
+			for (int32 Index = 0; Index < 100; ++Index)
+			{
+				TestWorld.SpawnReceiver(FVector(-300.0f, -200.0f + Index * 4.0f, 0.0f));
+			}
+		}
+
+		UBDC_InteractionSubsystem* Subsystem = TestWorld.GetSubsystem();
+		bool bEntered = false;
+		int32 FramesLost = 0;
+		for (int32 Frame = 0; Frame < 180; ++Frame)
+		{
+			TestWorld.Tick(1.0f / 60.0f);
+
+			const bool bInField = Subsystem->GetReceiversInFieldView(InstigatorComp).Contains(Target);
+			bEntered |= bInField;
+			FramesLost += bEntered && !bInField ? 1 : 0;
+		}
+
+		const TCHAR* Mode = bTimeSliced ? TEXT("time-sliced") : TEXT("throttled");
+		TestTrue(FString::Printf(TEXT("Visible receiver entered the field (%s)"), Mode), bEntered);
+		TestEqual(FString::Printf(TEXT("Frames the visible receiver dropped out of the field (%s)"), Mode), FramesLost, 0);
+	}
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FInteractionValidationRequestCapTest, "BDC.Interaction.Validation.RequestCap", BDC_INTERACTION_TEST_FLAGS)
+
+bool FInteractionValidationRequestCapTest::RunTest(const FString& Parameters)
+{
+	FInteractionTestSettingsScope Settings;
+	Settings->bAutoUpdateInteractions = false;
+	Settings->InteractionRange = 200.0f;
+	Settings->MaxInteractionRequestsPerSecond = 3;
+
+	FInteractionTestWorld TestWorld;
+	if (!TestTrue(TEXT("Test world created"), TestWorld.IsValid())) return false;
+
+	UInteractionInstigatorComponent* InstigatorComp = TestWorld.SpawnInstigator(FVector::ZeroVector);
+	UInteractionReceiverComponent* Target = TestWorld.SpawnReceiver(FVector(150.0f, 0.0f, 0.0f));
+	UBDC_InteractionSubsystem* Subsystem = TestWorld.GetSubsystem();
+
+	for (int32 Request = 0; Request < 3; ++Request)
+	{
+		TestTrue(FString::Printf(TEXT("Request %d within the cap is accepted"), Request), Subsystem->InjectValidatedInteractionFor(InstigatorComp, Target));
+	}
+	TestFalse(TEXT("Request beyond the cap is rejected"), Subsystem->InjectValidatedInteractionFor(InstigatorComp, Target));
+
+	TestWorld.Tick(1.1f);
+	TestTrue(TEXT("Next second accepts requests again"), Subsystem->InjectValidatedInteractionFor(InstigatorComp, Target));
+	return true;
+}
+
+#endif
@@ -0,0 +1,17 @@
+/* Copyright © beginning at 2026 - BlackDevilCreations
+ * Author: Patrick Wenzel
+ * All rights reserved.
+ * This file is part of a BlackDevilCreations project and may not be distributed, copied,
+ * or modified without prior written permission from BlackDevilCreations.
+ * Unreal Engine and its associated trademarks are property of Epic Games, Inc.
+ * and are used with permission.
+ */
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+
+#define BDC_INTERACTION_TEST_FLAGS (EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+// Wall-clock benchmarks stay out of product runs, machine load alone can fail their ratios.
+#define BDC_INTERACTION_PERF_TEST_FLAGS (EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
@@ -0,0 +1,139 @@
+/* Copyright © beginning at 2026 - BlackDevilCreations
+ * Author: Patrick Wenzel
+ * All rights reserved.
+ * This file is part of a BlackDevilCreations project and may not be distributed, copied,
+ * or modified without prior written permission from BlackDevilCreations.
+ * Unreal Engine and its associated trademarks are property of Epic Games, Inc.
+ * and are used with permission.
+ */
+#include "BDC_InteractionTestWorld.h"
+#include "BDC_InteractionSettings.h"
+#include "BDC_InteractionSubsystem.h"
+#include "Components/BoxComponent.h"
+#include "Components/InteractionInstigator.h"
+#include "Components/InteractionOccluder.h"
+#include "Components/InteractionReceiver.h"
+#include "Components/SceneComponent.h"
+#include "Engine/CollisionProfile.h"
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "GameFramework/WorldSettings.h"
+#include "Serialization/ObjectReader.h"
+#include "Serialization/ObjectWriter.h"
+
+FInteractionTestSettingsScope::FInteractionTestSettingsScope()
+	: Settings(GetMutableDefault<UBDC_InteractionSettings>())
+{
+	FObjectWriter Writer(Settings, SavedSettings);
+}
+
+FInteractionTestSettingsScope::~FInteractionTestSettingsScope()
+{
+	FObjectReader Reader(Settings, SavedSettings);
+}
+
+FInteractionTestWorld::FInteractionTestWorld()
+{
+	GameInstance = NewObject<UGameInstance>(GEngine);
+	GameInstance->AddToRoot();
+	GameInstance->InitializeStandalone();
+
+	World = GameInstance->GetWorld();
+	if (!World) return;
+
+	World->InitializeActorsForPlay(FURL());
+	World->BeginPlay();
+	if (!World->HasBegunPlay())
+	{
+		// Without a game mode nothing dispatches BeginPlay, which is what registers the components.
+		World->GetWorldSettings()->NotifyBeginPlay();
+	}
+
+	Subsystem = GameInstance->GetSubsystem<UBDC_InteractionSubsystem>();
+}
+
+FInteractionTestWorld::~FInteractionTestWorld()
+{
+	GameInstance->Shutdown();
+
+	if (World)
+	{
+		World->DestroyWorld(false);
+		GEngine->DestroyWorldContext(World);
+		World->RemoveFromRoot();
+	}
+
+	GameInstance->RemoveFromRoot();
+}
+
+AActor* FInteractionTestWorld::SpawnActor(const FVector& Location, const FRotator& Rotation)
+{
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	AActor* Actor = World->SpawnActor<AActor>(AActor::StaticClass(), FTransform(Rotation, Location), SpawnParams);
+	if (!Actor) return nullptr;
+
+	USceneComponent* Root = NewObject<USceneComponent>(Actor, TEXT("Root"));
+	Root->SetMobility(EComponentMobility::Movable);
+	Actor->SetRootComponent(Root);
+	Root->SetWorldLocationAndRotation(Location, Rotation);
+	Root->RegisterComponent();
+	return Actor;
+}
+
+UInteractionReceiverComponent* FInteractionTestWorld::SpawnReceiver(const FVector& Location, FName Name)
+{
+	AActor* Actor = SpawnActor(Location);
+	if (!Actor) return nullptr;
+
+	UInteractionReceiverComponent* ReceiverComp = NewObject<UInteractionReceiverComponent>(Actor, TEXT("Receiver"));
+	if (!Name.IsNone())
+	{
+		ReceiverComp->SetNameOfReceiver(Name);
+	}
+	ReceiverComp->RegisterComponent();
+	return ReceiverComp;
+}
+
+UInteractionInstigatorComponent* FInteractionTestWorld::SpawnInstigator(const FVector& Location, const FRotator& Rotation)
+{
+	AActor* Actor = SpawnActor(Location, Rotation);
+	if (!Actor) return nullptr;
+
+	UInteractionInstigatorComponent* InstigatorComp = NewObject<UInteractionInstigatorComponent>(Actor, TEXT("Instigator"));
+	InstigatorComp->NameOfInteractionComponent = TEXT("Root");
+	InstigatorComp->RegisterComponent();
+	return InstigatorComp;
+}
+
+UInteractionOccluderComponent* FInteractionTestWorld::SpawnOccluder(const FVector& Location, const FVector& Extent, bool bWithCollision)
+{
+	AActor* Actor = SpawnActor(Location);
+	if (!Actor) return nullptr;
+
+	UInteractionOccluderComponent* Occluder = NewObject<UInteractionOccluderComponent>(Actor, TEXT("Occluder"));
+	Occluder->BoxExtent = Extent;
+	Occluder->SetupAttachment(Actor->GetRootComponent());
+	Occluder->RegisterComponent();
+
+	if (bWithCollision)
+	{
+		UBoxComponent* Box = NewObject<UBoxComponent>(Actor, TEXT("OccluderCollision"));
+		Box->SetBoxExtent(Extent);
+		Box->SetCollisionProfileName(UCollisionProfile::BlockAll_ProfileName);
+		Box->SetupAttachment(Occluder);
+		Box->RegisterComponent();
+	}
+	return Occluder;
+}
+
+void FInteractionTestWorld::Tick(float DeltaSeconds, int32 Frames)
+{
+	for (int32 Frame = 0; Frame < Frames; ++Frame)
+	{
+		World->Tick(LEVELTICK_All, DeltaSeconds);
+	}
+}
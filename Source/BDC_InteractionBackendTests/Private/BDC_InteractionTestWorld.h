@@ -0,0 +1,60 @@
+/* Copyright © beginning at 2026 - BlackDevilCreations
+ * Author: Patrick Wenzel
+ * All rights reserved.
+ * This file is part of a BlackDevilCreations project and may not be distributed, copied,
+ * or modified without prior written permission from BlackDevilCreations.
+ * Unreal Engine and its associated trademarks are property of Epic Games, Inc.
+ * and are used with permission.
+ */
+#pragma once
+
+#include "CoreMinimal.h"
+
+class AActor;
+class UBDC_InteractionSettings;
+class UBDC_InteractionSubsystem;
+class UGameInstance;
+class UInteractionInstigatorComponent;
+class UInteractionOccluderComponent;
+class UInteractionReceiverComponent;
+class UWorld;
+
+/** Gives a test write access to the interaction settings and restores them when it goes out of scope. */
+class FInteractionTestSettingsScope
+{
+public:
+	FInteractionTestSettingsScope();
+	~FInteractionTestSettingsScope();
+
+	UBDC_InteractionSettings* operator->() const { return Settings; }
+
+private:
+	UBDC_InteractionSettings* Settings;
+	TArray<uint8> SavedSettings;
+};
+
+/** Standalone game world with its own game instance and subsystem, so tests never touch a running game. */
+class FInteractionTestWorld
+{
+public:
+	FInteractionTestWorld();
+	~FInteractionTestWorld();
+
+	bool IsValid() const { return World && Subsystem; }
+	UWorld* GetWorld() const { return World; }
+	UBDC_InteractionSubsystem* GetSubsystem() const { return Subsystem; }
+
+	AActor* SpawnActor(const FVector& Location, const FRotator& Rotation = FRotator::ZeroRotator);
+	UInteractionReceiverComponent* SpawnReceiver(const FVector& Location, FName Name = NAME_None);
+	UInteractionInstigatorComponent* SpawnInstigator(const FVector& Location, const FRotator& Rotation = FRotator::ZeroRotator);
+	/** Coarse occluder; bWithCollision adds a matching blocking box so line traces see it too. */
+	UInteractionOccluderComponent* SpawnOccluder(const FVector& Location, const FVector& Extent, bool bWithCollision);
+
+	/** Advances the world, including tickable objects and async traces. */
+	void Tick(float DeltaSeconds, int32 Frames = 1);
+
+private:
+	UGameInstance* GameInstance = nullptr;
+	UWorld* World = nullptr;
+	UBDC_InteractionSubsystem* Subsystem = nullptr;
+};